@@ -0,0 +1,90 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+// Test de charge de la compilation : 128 composants, 16 tags et 64 signatures générés.
+//
+// La cible EcsCompileStress est compilée avec une profondeur d'instanciation de templates
+// limitée (ECS_COMPILE_STRESS_TEMPLATE_DEPTH) : une métaprogrammation récursive sur les
+// listes de types fait échouer la compilation. La cible BenchEcsCompile mesure le temps de
+// compilation de ce fichier (cmake --build . --target BenchEcsCompile).
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Ecs.h"
+
+namespace {
+
+    constexpr std::size_t StressComponentCount{128};
+    constexpr std::size_t StressTagCount{16};
+    constexpr std::size_t StressSignatureCount{64};
+
+    template<std::size_t N>
+    struct CStress {
+        float value;
+    };
+
+    template<std::size_t N>
+    struct TStress {
+    };
+
+    // Signature N : trois composants répartis dans la liste et un tag
+    template<std::size_t N>
+    using SStress = ecs::Signature<
+        CStress<N>,
+        CStress<(N * 7 + 1) % StressComponentCount>,
+        CStress<(N * 13 + 2) % StressComponentCount>,
+        TStress<N % StressTagCount>
+    >;
+
+    template<std::size_t... TIndexes>
+    auto makeComponents(std::index_sequence<TIndexes...>) -> ecs::ComponentList<CStress<TIndexes>...>;
+
+    template<std::size_t... TIndexes>
+    auto makeTags(std::index_sequence<TIndexes...>) -> ecs::TagList<TStress<TIndexes>...>;
+
+    template<std::size_t... TIndexes>
+    auto makeSignatures(std::index_sequence<TIndexes...>) -> ecs::SignatureList<SStress<TIndexes>...>;
+
+    using StressSettings = ecs::Settings<
+        decltype(makeComponents(std::make_index_sequence<StressComponentCount>{})),
+        decltype(makeTags(std::make_index_sequence<StressTagCount>{})),
+        decltype(makeSignatures(std::make_index_sequence<StressSignatureCount>{}))
+    >;
+    using StressManager = ecs::Manager<StressSettings>;
+
+    static_assert(StressSettings::componentCount() == StressComponentCount);
+    static_assert(StressSettings::componentID<CStress<StressComponentCount - 1>>() == StressComponentCount - 1);
+    static_assert(StressSettings::signatureID<SStress<StressSignatureCount - 1>>() == StressSignatureCount - 1);
+    static_assert(ecs::tools::size_v<StressSettings::SignatureBitsets::SignatureComponents<SStress<5>>> == 3);
+
+}
+
+/**
+ * Instancie les principales fonctions du Manager pour tous les composants et signatures
+ */
+auto compileStress() -> std::size_t {
+    StressManager manager(64);
+
+    const auto entity_index(manager.createIndex());
+    ecs::tools::for_each_type<StressSettings::ComponentList>([&manager, entity_index]<typename TComponent>() {
+        manager.addComponent<TComponent>(entity_index, 1.f);
+    });
+    ecs::tools::for_each_type<StressSettings::TagList>([&manager, entity_index]<typename TTag>() {
+        manager.addTag<TTag>(entity_index);
+    });
+    manager.refresh();
+
+    std::size_t matches{0};
+    ecs::tools::for_each_type<StressSettings::SignatureList>([&manager, &matches]<typename TSignature>() {
+        manager.forEntitiesMatching<TSignature>([&matches](ecs::EntityIndex, auto &...) {
+            ++matches;
+        });
+    });
+
+    std::vector<std::byte> blob;
+    manager.saveSnapshot(blob);
+    return matches + blob.size() + manager.stats().totalBytes();
+}
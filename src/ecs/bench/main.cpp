@@ -0,0 +1,575 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+// BenchEcs : micro-benchmarks de l'ECS
+//
+//   BenchEcs [--output results.json] [--sizes 1000,100000,1000000] [--label texte]
+//
+// Chaque cas est mesuré plusieurs fois pour chaque nombre d'entités ; le JSON produit
+// (sortie standard par défaut) contient le minimum et la médiane de chaque cas, ce qui
+// permet de comparer deux commits. À compiler en Release : les assertions faussent les mesures.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Ecs.h"
+#include "tools/ThreadPool.h"
+
+
+// Components
+
+struct CPosition {
+    float x, y;
+};
+
+struct CVelocity {
+    float x, y;
+};
+
+struct CHealth {
+    int value;
+};
+
+// Apparence commune à une population (quatre valeurs distinctes)
+struct CStyle {
+    float color[4];
+    float outlineThickness;
+    float radius;
+    int pointCount;
+    int layer;
+
+    auto operator==(const CStyle &) const -> bool = default;
+};
+
+// Tags
+
+struct TEnemy {
+};
+
+struct TBoss {
+};
+
+// Signatures
+
+// Toutes les entités
+using SDense = ecs::Signature<CPosition, CVelocity>;
+// Une entité sur dix
+using SSparse = ecs::Signature<CHealth, TEnemy>;
+// Une entité sur dix mille (tag rare : seuls ses porteurs sont examinés)
+using SRare = ecs::Signature<CPosition, TBoss>;
+
+using BenchSettings = ecs::Settings<
+    ecs::ComponentList<CPosition, CVelocity, CHealth>,
+    ecs::TagList<TEnemy, TBoss>,
+    ecs::SignatureList<SDense, SSparse, SRare>
+>;
+using BenchManager = ecs::Manager<BenchSettings>;
+
+// Mêmes données, SDense déclarée comme groupe possédant
+using BenchGroupSettings = ecs::Settings<
+    ecs::ComponentList<CPosition, CVelocity, CHealth>,
+    ecs::TagList<TEnemy, TBoss>,
+    ecs::SignatureList<SDense, SSparse>,
+    ecs::SystemList<>,
+    ecs::ResourceList<>,
+    ecs::GroupList<SDense>
+>;
+using BenchGroupManager = ecs::Manager<BenchGroupSettings>;
+
+// Apparence recopiée dans chaque entité ou partagée (ecs::Shared<CStyle>)
+using SStyleCopied = ecs::Signature<CPosition, CStyle>;
+using SStyleShared = ecs::Signature<CPosition, ecs::Shared<CStyle>>;
+
+using BenchStyleSettings = ecs::Settings<
+    ecs::ComponentList<CPosition, CStyle, ecs::Shared<CStyle>>,
+    ecs::TagList<>,
+    ecs::SignatureList<SStyleCopied, SStyleShared>
+>;
+using BenchStyleManager = ecs::Manager<BenchStyleSettings>;
+
+
+// Harness
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Empêche le compilateur de supprimer un calcul dont le résultat n'est pas utilisé
+     */
+    template<typename T>
+    void doNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const T *sink;
+        sink = &value;
+#endif
+    }
+
+    struct Result {
+        std::string name;
+        std::size_t entities;
+        std::size_t repetitions;
+        std::int64_t min_ns;
+        std::int64_t median_ns;
+    };
+
+    /**
+     * Mesure d'un cas : setup() n'est pas chronométré, run() l'est
+     */
+    struct Case {
+        std::string_view name;
+        std::function<void(std::size_t entities)> setup;
+        std::function<void(std::size_t entities)> run;
+    };
+
+    auto repetitionsFor(const std::size_t entities) -> std::size_t {
+        if (entities <= 10'000) return 50;
+        if (entities <= 100'000) return 10;
+        return 3;
+    }
+
+    auto measure(const Case &bench_case, const std::size_t entities) -> Result {
+        const auto repetitions(repetitionsFor(entities));
+        std::vector<std::int64_t> samples;
+        samples.reserve(repetitions);
+
+        for (std::size_t i{0}; i < repetitions; ++i) {
+            if (bench_case.setup) bench_case.setup(entities);
+
+            const auto start(Clock::now());
+            bench_case.run(entities);
+            const auto stop(Clock::now());
+
+            samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+        }
+
+        std::ranges::sort(samples);
+        return {std::string(bench_case.name), entities, repetitions, samples.front(), samples[samples.size() / 2]};
+    }
+
+    /**
+     * Remplit un Manager : toutes les entités ont CPosition et CVelocity, une sur dix CHealth et TEnemy
+     */
+    template<typename TManager>
+    auto populate(TManager &manager, const std::size_t entities) -> void {
+        for (std::size_t i{0}; i < entities; ++i) {
+            const auto index(manager.createIndex());
+            manager.template addComponent<CPosition>(index, static_cast<float>(i), 0.f);
+            manager.template addComponent<CVelocity>(index, 1.f, 1.f);
+            if (i % 10 == 0) {
+                manager.template addComponent<CHealth>(index, 100);
+                manager.template addTag<TEnemy>(index);
+            }
+            if (i % 10000 == 5) manager.template addTag<TBoss>(index);
+        }
+        manager.refresh();
+    }
+
+    /**
+     * Tue une proportion donnée des entités (tirage reproductible)
+     */
+    auto killRatio(BenchManager &manager, const double ratio) -> void {
+        std::mt19937 random(42);
+        std::bernoulli_distribution kill(ratio);
+        manager.forEntities([&manager, &random, &kill](const ecs::EntityIndex entity_index) {
+            if (kill(random)) manager.kill(entity_index);
+        });
+    }
+
+    auto writeJson(std::ostream &out, const std::vector<Result> &results, const std::string &label) -> void {
+        out << "{\n";
+        out << "  \"label\": \"" << label << "\",\n";
+#ifdef NDEBUG
+        out << "  \"assertions\": false,\n";
+#else
+        out << "  \"assertions\": true,\n";
+#endif
+        out << "  \"results\": [\n";
+        for (std::size_t i{0}; i < results.size(); ++i) {
+            const auto &[name, entities, repetitions, min_ns, median_ns] = results[i];
+            out << "    {\"name\": \"" << name << "\", \"entities\": " << entities
+                    << ", \"repetitions\": " << repetitions
+                    << ", \"min_ns\": " << min_ns
+                    << ", \"median_ns\": " << median_ns
+                    << ", \"ns_per_entity\": " << static_cast<double>(median_ns) / static_cast<double>(entities)
+                    << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n";
+        out << "}\n";
+    }
+
+    auto parseSizes(const std::string_view text) -> std::vector<std::size_t> {
+        std::vector<std::size_t> sizes;
+        std::size_t value{0};
+        for (const auto c: text) {
+            if (c == ',') {
+                sizes.push_back(value);
+                value = 0;
+            } else {
+                value = value * 10 + static_cast<std::size_t>(c - '0');
+            }
+        }
+        sizes.push_back(value);
+        return sizes;
+    }
+
+}
+
+
+int main(const int argc, char **argv) {
+    std::vector<std::size_t> sizes{1'000, 100'000, 1'000'000};
+    std::string output_path;
+    std::string label;
+
+    for (auto i(1); i + 1 < argc; i += 2) {
+        const std::string_view option(argv[i]);
+        if (option == "--output") output_path = argv[i + 1];
+        else if (option == "--sizes") sizes = parseSizes(argv[i + 1]);
+        else if (option == "--label") label = argv[i + 1];
+        else {
+            std::cerr << "Unknown option " << option << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Manager partagé par les cas (reconstruit par leur setup)
+    auto manager(std::make_unique<BenchManager>());
+    std::vector<ecs::Handle> handles;
+
+    auto group_manager(std::make_unique<BenchGroupManager>());
+    auto style_manager(std::make_unique<BenchStyleManager>());
+
+    const auto fresh = [&manager](const std::size_t entities) {
+        manager = std::make_unique<BenchManager>(entities);
+    };
+    const auto populated = [&manager](const std::size_t entities) {
+        manager = std::make_unique<BenchManager>(entities);
+        populate(*manager, entities);
+    };
+    const auto populatedWithDead = [&populated, &manager](const double ratio) {
+        return [&populated, &manager, ratio](const std::size_t entities) {
+            populated(entities);
+            killRatio(*manager, ratio);
+        };
+    };
+    // Une entité sur deux perd CVelocity : le groupe ne contient que l'autre moitié, les deux
+    // moitiés étant entrelacées dans l'ordre des entités
+    const auto populatedGroup = [&group_manager](const std::size_t entities) {
+        group_manager = std::make_unique<BenchGroupManager>(entities);
+        populate(*group_manager, entities);
+        group_manager->forEntities([&group_manager](const ecs::EntityIndex entity_index) {
+            if (entity_index.get() % 2 == 0) group_manager->delComponent<CVelocity>(entity_index);
+        });
+        group_manager->refresh();
+    };
+    const auto populatedHalf = [&manager](const std::size_t entities) {
+        manager = std::make_unique<BenchManager>(entities);
+        populate(*manager, entities);
+        manager->forEntities([&manager](const ecs::EntityIndex entity_index) {
+            if (entity_index.get() % 2 == 0) manager->delComponent<CVelocity>(entity_index);
+        });
+        manager->refresh();
+    };
+    const auto styled = [&style_manager](const bool shared) {
+        return [&style_manager, shared](const std::size_t entities) {
+            style_manager = std::make_unique<BenchStyleManager>(entities);
+            for (std::size_t i{0}; i < entities; ++i) {
+                const auto index(style_manager->createIndex());
+                style_manager->addComponent<CPosition>(index, static_cast<float>(i), 0.f);
+                const CStyle style{{1.f, 0.5f, 0.f, 1.f}, 2.f, static_cast<float>(i % 4), 16, 0};
+                if (shared) style_manager->setShared(index, style);
+                else style_manager->addComponent<CStyle>(index, style);
+            }
+            style_manager->refresh();
+        };
+    };
+    // Historique de 16 frames sur un monde peuplé, dont 9 déjà enregistrées. Chaque frame
+    // déplace une entité sur cent
+    std::unique_ptr<ecs::Rollback<BenchManager>> rollback;
+    const auto simulateFrame = [&manager, &rollback](const std::size_t entities) {
+        for (std::size_t i{0}; i < entities; i += 100) {
+            manager->getComponent<CPosition>(ecs::EntityIndex{i}).x += 1.f;
+        }
+        rollback->record();
+    };
+    const auto recorded = [&populated, &manager, &rollback, &simulateFrame](const std::size_t entities) {
+        populated(entities);
+        rollback = std::make_unique<ecs::Rollback<BenchManager>>(*manager, 16);
+        rollback->record();
+        for (auto frame(0); frame < 8; ++frame) simulateFrame(entities);
+    };
+    const auto withHandles = [&manager, &handles](const std::size_t entities) {
+        manager = std::make_unique<BenchManager>(entities);
+        handles.clear();
+        for (std::size_t i{0}; i < entities; ++i) {
+            handles.push_back(manager->createHandle());
+        }
+        manager->refresh();
+    };
+
+    // Capacité suffisante pour les index laissés inutilisés par les créateurs concurrents
+    const auto freshWithSlack = [&manager](const std::size_t entities) {
+        manager = std::make_unique<BenchManager>(entities + 4 * 63);
+    };
+
+    // Pool créé hors mesure : seuls la réservation des blocs et l'initialisation sont chronométrées
+    ecs::tools::ThreadPool pool(3);
+    const auto concurrentCreate = [&manager, &pool](const std::size_t block_size, const std::size_t tasks) {
+        return [&manager, &pool, block_size, tasks](const std::size_t entities) {
+            {
+                ecs::ConcurrentCreation creation(*manager, entities + tasks * (block_size - 1), block_size);
+                pool.parallelFor(tasks, [&creation, entities, tasks](const std::size_t task) {
+                    auto creator(creation.creator());
+                    for (auto i(task * entities / tasks); i < (task + 1) * entities / tasks; ++i) {
+                        creator.create([i](BenchManager &m, const ecs::EntityIndex index, ecs::Handle) {
+                            m.addComponent<CPosition>(index, static_cast<float>(i), 0.f);
+                        });
+                    }
+                });
+            }
+            manager->refresh();
+        };
+    };
+
+    const std::vector<Case> cases{
+        {
+            "create_kill_churn", fresh, [&manager](const std::size_t entities) {
+                // Deux cycles création / mort / refresh, le second réutilise le stockage
+                for (auto cycle(0); cycle < 2; ++cycle) {
+                    for (std::size_t i{0}; i < entities; ++i) {
+                        manager->addComponent<CPosition>(manager->createIndex(), 0.f, 0.f);
+                    }
+                    manager->refresh();
+                    manager->forEntities([&manager](const ecs::EntityIndex entity_index) {
+                        manager->kill(entity_index);
+                    });
+                    manager->refresh();
+                }
+            }
+        },
+        {"refresh_dead_10", populatedWithDead(0.1), [&manager](std::size_t) { manager->refresh(); }},
+        {"refresh_dead_50", populatedWithDead(0.5), [&manager](std::size_t) { manager->refresh(); }},
+        {"refresh_dead_90", populatedWithDead(0.9), [&manager](std::size_t) { manager->refresh(); }},
+        {
+            "for_each_dense", populated, [&manager](std::size_t) {
+                float sum{0.f};
+                manager->forEntitiesMatching<SDense>(
+                    [&sum](ecs::EntityIndex, CPosition &position, const CVelocity &velocity) {
+                        position.x += velocity.x;
+                        sum += position.x;
+                    });
+                doNotOptimize(sum);
+            }
+        },
+        {
+            "for_each_half", populatedHalf, [&manager](std::size_t) {
+                float sum{0.f};
+                manager->forEntitiesMatching<SDense>(
+                    [&sum](ecs::EntityIndex, CPosition &position, const CVelocity &velocity) {
+                        position.x += velocity.x;
+                        sum += position.x;
+                    });
+                doNotOptimize(sum);
+            }
+        },
+        {
+            // Même parcours que for_each_dense au travers de la vue (ranges) : doit coûter autant
+            "view_dense", populated, [&manager](std::size_t) {
+                float sum{0.f};
+                for (auto [entity_index, position, velocity]: manager->view<SDense>()) {
+                    position.x += velocity.x;
+                    sum += position.x;
+                }
+                doNotOptimize(sum);
+            }
+        },
+        {
+            "view_half", populatedHalf, [&manager](std::size_t) {
+                float sum{0.f};
+                for (auto [entity_index, position, velocity]: manager->view<SDense>()) {
+                    position.x += velocity.x;
+                    sum += position.x;
+                }
+                doNotOptimize(sum);
+            }
+        },
+        {
+            "for_each_group_half", populatedGroup, [&group_manager](std::size_t) {
+                float sum{0.f};
+                group_manager->forGroup<SDense>(
+                    [&sum](ecs::EntityIndex, CPosition &position, const CVelocity &velocity) {
+                        position.x += velocity.x;
+                        sum += position.x;
+                    });
+                doNotOptimize(sum);
+            }
+        },
+        {
+            // Coût du reclassement : un dixième des membres sort du groupe puis y revient
+            "group_churn_10", populatedGroup, [&group_manager](const std::size_t entities) {
+                for (std::size_t i{1}; i < entities; i += 20) {
+                    group_manager->delComponent<CVelocity>(ecs::EntityIndex{i});
+                }
+                group_manager->refresh();
+                for (std::size_t i{1}; i < entities; i += 20) {
+                    group_manager->addComponent<CVelocity>(ecs::EntityIndex{i}, 1.f, 1.f);
+                }
+                group_manager->refresh();
+            }
+        },
+        {
+            // Lecture d'une apparence commune : 40 octets par entité contre un index de 4 octets
+            "for_each_style_copied", styled(false), [&style_manager](std::size_t) {
+                float sum{0.f};
+                style_manager->forEntitiesMatching<SStyleCopied>(
+                    [&sum](ecs::EntityIndex, const CPosition &position, const CStyle &style) {
+                        sum += position.x * style.radius;
+                    });
+                doNotOptimize(sum);
+            }
+        },
+        {
+            "for_each_style_shared", styled(true), [&style_manager](std::size_t) {
+                float sum{0.f};
+                style_manager->forEntitiesMatching<SStyleShared>(
+                    [&sum](ecs::EntityIndex, const CPosition &position, const CStyle &style) {
+                        sum += position.x * style.radius;
+                    });
+                doNotOptimize(sum);
+            }
+        },
+        {
+            // Marquage d'une entité sur dix (refresh non mesuré) : kill dans une itération, killIf,
+            // killIf sur un groupe
+            "kill_loop_10", populated, [&manager](std::size_t) {
+                manager->forEntitiesMatching<SDense>(
+                    [&manager](const ecs::EntityIndex entity_index, const CPosition &position, const CVelocity &) {
+                        if (static_cast<int>(position.x) % 10 == 0) manager->kill(entity_index);
+                    });
+            }
+        },
+        {
+            "kill_if_10", populated, [&manager](std::size_t) {
+                manager->killIf<SDense>([](const CPosition &position, const CVelocity &) {
+                    return static_cast<int>(position.x) % 10 == 0;
+                });
+            }
+        },
+        {
+            "kill_if_group_half_10", populatedGroup, [&group_manager](std::size_t) {
+                group_manager->killIf<SDense>([](const CPosition &position, const CVelocity &) {
+                    return static_cast<int>(position.x) % 10 == 1;
+                });
+            }
+        },
+        {
+            "for_each_sparse", populated, [&manager](std::size_t) {
+                int sum{0};
+                manager->forEntitiesMatching<SSparse>([&sum](ecs::EntityIndex, const CHealth &health) {
+                    sum += health.value;
+                });
+                doNotOptimize(sum);
+            }
+        },
+        {
+            "for_each_rare_tag", populated, [&manager](std::size_t) {
+                float sum{0.f};
+                manager->forEntitiesMatching<SRare>([&sum](ecs::EntityIndex, const CPosition &position) {
+                    sum += position.x;
+                });
+                doNotOptimize(sum);
+            }
+        },
+        {
+            "add_component_by_handle", withHandles, [&manager, &handles](std::size_t) {
+                for (const auto &handle: handles) {
+                    manager->addComponent<CHealth>(handle, 1);
+                }
+            }
+        },
+        {
+            "get_component_by_handle",
+            [&withHandles, &manager, &handles](const std::size_t entities) {
+                withHandles(entities);
+                for (const auto &handle: handles) {
+                    manager->addComponent<CHealth>(handle, 1);
+                }
+            },
+            [&manager, &handles](std::size_t) {
+                int sum{0};
+                for (const auto &handle: handles) {
+                    sum += std::as_const(*manager).getComponent<CHealth>(handle).value;
+                }
+                doNotOptimize(sum);
+            }
+        },
+        {
+            // Croissance depuis une petite capacité : le coût total inclut tous les agrandissements
+            "grow_from_16", [&manager](std::size_t) { manager = std::make_unique<BenchManager>(16); },
+            [&manager](const std::size_t entities) {
+                for (std::size_t i{0}; i < entities; ++i) {
+                    manager->createIndex();
+                }
+            }
+        },
+        // Contention de la réservation : blocs d'une entité (un atomique par création) ou de 64,
+        // création sur un thread (référence) ou sur quatre (pool de trois threads et l'appelant)
+        {"rollback_record", recorded, simulateFrame},
+        {
+            // Retour de 8 frames puis resimulation de ces 8 frames (rollback réseau)
+            "rollback_8_frames", recorded, [&rollback, &simulateFrame](const std::size_t entities) {
+                if (!rollback->rollback(8)) std::abort();
+                for (auto frame(0); frame < 8; ++frame) simulateFrame(entities);
+            }
+        },
+        {"concurrent_create_b1_t1", freshWithSlack, concurrentCreate(1, 1)},
+        {"concurrent_create_b1_t4", freshWithSlack, concurrentCreate(1, 4)},
+        {"concurrent_create_b64_t1", freshWithSlack, concurrentCreate(64, 1)},
+        {"concurrent_create_b64_t4", freshWithSlack, concurrentCreate(64, 4)},
+    };
+
+    std::vector<Result> results;
+    for (const auto entities: sizes) {
+        for (const auto &bench_case: cases) {
+            results.push_back(measure(bench_case, entities));
+            std::cerr << results.back().name << " @" << entities << " : "
+                    << static_cast<double>(results.back().median_ns) / 1e6 << " ms" << std::endl;
+        }
+
+        // Pic de latence d'une création qui déclenche un agrandissement du stockage
+        manager = std::make_unique<BenchManager>(16);
+        std::int64_t worst_ns{0};
+        for (std::size_t i{0}; i < entities; ++i) {
+            const auto start(Clock::now());
+            manager->createIndex();
+            worst_ns = std::max(worst_ns,
+                                std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+        }
+        results.push_back({"grow_spike_worst_create", entities, 1, worst_ns, worst_ns});
+        std::cerr << "grow_spike_worst_create @" << entities << " : " << static_cast<double>(worst_ns) / 1e6
+                << " ms" << std::endl;
+    }
+
+    if (output_path.empty()) {
+        writeJson(std::cout, results, label);
+    } else {
+        std::ofstream output(output_path);
+        writeJson(output, results, label);
+    }
+
+    return EXIT_SUCCESS;
+}
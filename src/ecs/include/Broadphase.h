@@ -0,0 +1,47 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_BROADPHASE_H
+#define ECS_BROADPHASE_H
+
+#include <span>
+
+#include "EcsTypes.h"
+
+namespace ecs {
+
+    // Broadphase
+    // /   Fournisseur de paires candidates pour Manager::forPairsMatching.
+    // /   Un broadphase reçoit les entités des deux signatures et émet les couples
+    // /   (a, b) susceptibles d'interagir. Il peut élaguer autant qu'il le souhaite,
+    // /   mais ne doit jamais omettre un couple qui interagit réellement.
+    // /
+    // /   Interface attendue :
+    // /
+    // /   template<typename TManager, typename TEmit>
+    // /   void forEachCandidate(TManager &manager,
+    // /                         std::span<const EntityIndex> entities_a,
+    // /                         std::span<const EntityIndex> entities_b,
+    // /                         TEmit &&emit);   // emit(EntityIndex a, EntityIndex b)
+
+    /**
+     * Broadphase par défaut : émet tous les couples (a, b) possibles
+     */
+    struct BruteForceBroadphase {
+        template<typename TManager, typename TEmit>
+        auto forEachCandidate([[maybe_unused]] TManager &manager,
+                              const std::span<const EntityIndex> entities_a,
+                              const std::span<const EntityIndex> entities_b,
+                              TEmit &&emit) const -> void {
+            for (const auto entity_a: entities_a) {
+                for (const auto entity_b: entities_b) {
+                    emit(entity_a, entity_b);
+                }
+            }
+        }
+    };
+
+}
+
+#endif //ECS_BROADPHASE_H
@@ -0,0 +1,178 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_CONCURRENT_CREATION_H
+#define ECS_CONCURRENT_CREATION_H
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "EcsTypes.h"
+
+namespace ecs {
+
+    /**
+     * Création d'entités depuis plusieurs threads (particules, fragments de projectiles, ... créés
+     * par des systèmes exécutés en parallèle).
+     *
+     * Le constructeur (point de synchronisation, thread principal) garantit la capacité pour
+     * reserve_count entités. Chaque thread crée ensuite ses entités au travers de son propre
+     * Creator, qui réserve des blocs d'index consécutifs par un simple compteur atomique : aucun
+     * verrou tant que la capacité réservée suffit. Au-delà, les créations sont différées et
+     * exécutées par finish() (second point de synchronisation, thread principal), qui peut
+     * alors agrandir le stockage.
+     *
+     *   ecs::ConcurrentCreation creation(manager, 1000);
+     *   pool.parallelFor(count, [&creation](std::size_t) {
+     *       auto creator(creation.creator());
+     *       creator.create([](Manager &m, ecs::EntityIndex index, ecs::Handle) { m.addComponent<CPosition>(index); });
+     *   });
+     *   creation.finish();
+     *
+     * Entre les deux points de synchronisation, un thread ne doit modifier que les entités qu'il
+     * vient de créer (addComponent, addTag, ...) et aucune autre opération structurelle n'est
+     * permise (createIndex, kill d'autres entités, refresh, ...). Les observateurs sont notifiés
+     * au refresh suivant, comme pour une création classique : les événements sont enregistrés par
+     * finish() (ajout des composants et tags présents sur les entités créées).
+     *
+     * Les blocs réservés mais inutilisés deviennent des entités mortes, retirées au refresh.
+     *
+     * @tparam TManager Type du Manager
+     */
+    template<typename TManager>
+    class ConcurrentCreation {
+    public:
+        /**
+         * Fonction d'initialisation d'une entité : void(TManager &, EntityIndex, Handle)
+         */
+        using Initializer = std::function<void(TManager &, EntityIndex, Handle)>;
+
+        /**
+         * Créateur d'entités propre à un thread (à ne pas partager)
+         */
+        class Creator {
+            ConcurrentCreation *creation_;
+            std::size_t next_{0};
+            std::size_t end_{0};
+
+        public:
+            explicit Creator(ConcurrentCreation &creation) noexcept : creation_{&creation} {}
+
+            /**
+             * Crée une entité et l'initialise avec init(manager, index, handle).
+             *
+             * L'initialisation est immédiate (thread courant) si la capacité réservée le
+             * permet ; sinon elle est différée jusqu'à finish() (thread principal).
+             *
+             * @param init Fonction d'initialisation (copiée si la création est différée)
+             * @return true si l'entité a été créée immédiatement
+             */
+            template<typename TInit>
+            auto create(TInit &&init) -> bool {
+                if (next_ == end_ && !creation_->reserveBlock(next_, end_)) {
+                    creation_->defer(Initializer(std::forward<TInit>(init)));
+                    return false;
+                }
+
+                const EntityIndex index{next_++};
+                init(creation_->manager_, index, creation_->manager_.initConcurrentEntity(index));
+                return true;
+            }
+        };
+
+    private:
+        TManager &manager_;
+        std::size_t blockSize_;
+        std::size_t first_;
+        std::size_t capacity_;
+        std::atomic<std::size_t> cursor_;
+
+        std::mutex deferredMutex_;
+        std::vector<Initializer> deferred_;
+        bool finished_{false};
+
+        /**
+         * Réserve le prochain bloc d'index (sans verrou)
+         *
+         * @return false si la capacité réservée est épuisée
+         */
+        auto reserveBlock(std::size_t &next, std::size_t &end) noexcept -> bool {
+            const auto first(cursor_.fetch_add(blockSize_, std::memory_order_relaxed));
+            if (first >= capacity_) return false;
+
+            next = first;
+            end = std::min(first + blockSize_, capacity_);
+            return true;
+        }
+
+        auto defer(Initializer &&init) -> void {
+            std::lock_guard lock(deferredMutex_);
+            deferred_.push_back(std::move(init));
+        }
+
+    public:
+        /**
+         * Début de la création concurrente (thread principal)
+         *
+         * @param manager Manager dans lequel créer les entités
+         * @param reserve_count Nombre d'index réservés : chaque Creator peut laisser jusqu'à
+         *                      block_size - 1 index inutilisés dans son dernier bloc
+         * @param block_size Nombre d'index réservés à la fois par un Creator
+         */
+        ConcurrentCreation(TManager &manager, const std::size_t reserve_count, const std::size_t block_size = 64)
+            : manager_{manager}, blockSize_{block_size}, first_{manager.beginConcurrentCreation(reserve_count)},
+              capacity_{manager.getCapacity()}, cursor_{first_} {
+            assert(block_size > 0);
+        }
+
+        ~ConcurrentCreation() {
+            finish();
+        }
+
+        ConcurrentCreation(const ConcurrentCreation &) = delete;
+        ConcurrentCreation &operator=(const ConcurrentCreation &) = delete;
+
+        /**
+         * Retourne un créateur pour le thread courant
+         */
+        [[nodiscard]] auto creator() noexcept -> Creator {
+            return Creator{*this};
+        }
+
+        /**
+         * Fin de la création concurrente (thread principal, après la fin de tous les créateurs) :
+         * les créations différées sont exécutées, le stockage est agrandi si nécessaire.
+         * Les entités créées sont visibles après le prochain refresh.
+         */
+        auto finish() -> void {
+            if (finished_) return;
+            finished_ = true;
+
+            manager_.endConcurrentCreation(first_, cursor_.load(std::memory_order_relaxed));
+
+            for (auto &init: deferred_) {
+                const auto handle(manager_.createHandle());
+                init(manager_, manager_.getEntityIndex(handle), handle);
+            }
+            deferred_.clear();
+        }
+
+        /**
+         * Nombre de créations différées (capacité réservée insuffisante)
+         */
+        [[nodiscard]] auto deferredCount() noexcept -> std::size_t {
+            std::lock_guard lock(deferredMutex_);
+            return deferred_.size();
+        }
+    };
+
+}
+
+#endif //ECS_CONCURRENT_CREATION_H
@@ -26,7 +26,12 @@
 
 #include "EcsTypes.h"
 #include "Settings.h"
+#include "Broadphase.h"
+#include "ConcurrentCreation.h"
+#include "Hierarchy.h"
 #include "Manager.h"
+#include "Rollback.h"
+#include "TickTiers.h"
 
 
 // Inspirations = https://github.com/CppCon/CppCon2015/blob/master/Tutorials/Implementation%20of%20a%20component-based%20entity%20system%20in%20modern%20C%2B%2B/Source%20Code/p3.cpp
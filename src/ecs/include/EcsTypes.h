@@ -5,6 +5,8 @@
 #ifndef ECS_TYPES_H
 #define ECS_TYPES_H
 
+#include <cstdint>
+
 #include "impl/Tags.h"
 #include "tools/StrongTypedef.h"
 #include "tools/TypeList.h"
@@ -18,6 +20,58 @@ namespace ecs {
     using Signature = tools::TypeList<Ts...>;
     template<typename... Ts>
     using SignatureList = tools::TypeList<Ts...>;
+    template<typename... Ts>
+    using SystemList = tools::TypeList<Ts...>;
+    template<typename... Ts>
+    using ResourceList = tools::TypeList<Ts...>;
+    template<typename... Ts>
+    using GroupList = tools::TypeList<Ts...>;
+
+    /**
+     * Liste des types lus par un système
+     *
+     * @tparam Ts Types accédés en lecture seule
+     */
+    template<typename... Ts>
+    struct Reads {
+        using TypeList = tools::TypeList<Ts...>;
+    };
+
+    /**
+     * Liste des types modifiés par un système
+     *
+     * @tparam Ts Types accédés en écriture (et donc aussi en lecture)
+     */
+    template<typename... Ts>
+    struct Writes {
+        using TypeList = tools::TypeList<Ts...>;
+    };
+
+    /**
+     * Pseudo-type d'accès représentant la structure du monde : création et destruction
+     * d'entités, ajout et retrait de composants ou de tags, activation, refresh.
+     *
+     * Un système qui déclare ecs::Writes<ecs::Entities> est exclusif : ces opérations
+     * invalident les itérations en cours, il est donc en conflit avec tous les autres systèmes.
+     */
+    struct Entities {};
+
+    /**
+     * Classe de base permettant à un système de déclarer ses accès à la compilation.
+     *
+     * Exemple :
+     *   struct MovementSystem : ecs::System<ecs::Reads<CInput>, ecs::Writes<CTransform>> {};
+     *
+     * @tparam TReads Types lus par le système (ecs::Reads<...>)
+     * @tparam TWrites Types modifiés par le système (ecs::Writes<...>)
+     */
+    template<typename TReads = Reads<>, typename TWrites = Writes<>>
+    struct System {
+        // ReadList = TypeList<C0, C1, ...>
+        using ReadList = typename TReads::TypeList;
+        // WriteList = TypeList<C2, C3, ...>
+        using WriteList = typename TWrites::TypeList;
+    };
 
     using EntityIndex = tools::strong_typedef<std::size_t, impl::EntityIndexTag>;
 
@@ -26,10 +80,67 @@ namespace ecs {
     using HandleDataIndex = tools::strong_typedef<std::size_t, impl::HandleDataIndexTag>;
     using Counter = tools::strong_typedef<int, impl::CounterTag>;
 
+    /**
+     * Horloge logique utilisée pour la détection des changements de composants
+     */
+    using ChangeTick = tools::strong_typedef<std::uint32_t, impl::ChangeTickTag>;
+
+    /**
+     * Filtre de requête : le composant T a été modifié depuis le dernier passage
+     *
+     * @tparam T Type de composant
+     */
+    template<typename T>
+    struct Changed {
+    };
+
+    /**
+     * Filtre de requête : le composant T a été ajouté depuis le dernier passage
+     *
+     * @tparam T Type de composant
+     */
+    template<typename T>
+    struct Added {
+    };
+
+    /**
+     * Position d'une requête découpée sur plusieurs frames (voir Manager::forEntitiesMatching
+     * avec un budget) : l'itération reprend à la frame suivante là où elle s'est arrêtée.
+     *
+     * Le curseur est un simple index : il n'est pas ajusté par Manager::refresh. Une passe qui
+     * s'étend sur plusieurs refresh est donc approximative : les entités que le compactage
+     * déplace de la fin du tableau vers un index déjà parcouru sont manquées par cette passe
+     * (elles sont vues à la suivante). Ne pas l'utiliser pour un traitement qui doit voir
+     * chaque entité exactement une fois par passe.
+     */
+    struct QueryCursor {
+        // Prochaine entité à examiner
+        EntityIndex next{0};
+        // Nombre de passes complètes sur les entités
+        std::size_t passes{0};
+    };
+
+    /**
+     * Composant partagé : l'entité ne stocke que l'index d'une valeur dédupliquée et comptée
+     * par référence, commune à toutes les entités ayant la même valeur. À déclarer dans la
+     * ComponentList (ecs::Shared<CStyle>) et à manipuler avec Manager::setShared, getShared et
+     * updateShared. Les requêtes fournissent une référence constante vers la valeur (const T &).
+     *
+     * @tparam T Type de la valeur partagée (comparable avec operator==)
+     */
+    template<typename T>
+    struct Shared {
+        using Type = T;
+
+        std::uint32_t index{0};
+    };
+
     struct Handle {
         // TODO : Faire en sorte que le contenu ne puisse pas être visible pour le développeur
         HandleDataIndex handleDataIndex;
         Counter counter;
+
+        auto operator==(const Handle &) const -> bool = default;
     };
 }
 
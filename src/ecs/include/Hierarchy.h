@@ -0,0 +1,304 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_HIERARCHY_H
+#define ECS_HIERARCHY_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "EcsTypes.h"
+
+namespace ecs {
+
+    /**
+     * Composant de hiérarchie : lien vers le parent et liste chaînée des enfants
+     * (premier enfant / frère suivant).
+     *
+     * Ce composant doit être déclaré dans la ComponentList des Settings pour utiliser
+     * ecs::Hierarchy. Il ne doit être modifié qu'au travers de ecs::Hierarchy.
+     */
+    struct CHierarchy {
+        // Handle de l'entité elle-même (les index changent au refresh, pas les handles)
+        Handle self{};
+        std::optional<Handle> parent;
+        std::optional<Handle> first_child;
+        std::optional<Handle> next_sibling;
+        // Profondeur dans l'arbre (0 pour une racine)
+        std::uint32_t depth{0};
+    };
+
+    /**
+     * Gestion des relations parent/enfant entre entités et propagation des transformations.
+     *
+     * Les enfants sont conservés dans un tableau trié par profondeur (ordre d'un parcours en
+     * largeur) : un parent est toujours traité avant ses enfants, et la propagation est un
+     * simple balayage séquentiel, sans récursion ni parcours des listes chaînées. Le tableau
+     * n'est reconstruit que lorsque la structure de l'arbre change.
+     *
+     * La mort d'un parent entraîne celle de toute sa descendance (au refresh, via onKilled).
+     *
+     * @tparam TManager Type du Manager
+     */
+    template<typename TManager>
+    class Hierarchy {
+        struct Link {
+            Handle entity;
+            Handle parent;
+            std::uint32_t depth;
+        };
+
+        TManager &manager_;
+
+        /**
+         * Enfants triés par profondeur
+         */
+        std::vector<Link> links_;
+
+        /**
+         * Indique si links_ doit être reconstruit avant le prochain balayage
+         */
+        bool dirty_{false};
+
+        auto hierarchy(const Handle &handle) noexcept -> CHierarchy & {
+            return manager_.template getComponent<CHierarchy>(handle);
+        }
+
+        auto ensureHierarchy(const Handle &handle) -> CHierarchy & {
+            if (!manager_.template hasComponent<CHierarchy>(handle)) {
+                manager_.template addComponent<CHierarchy>(handle).self = handle;
+            }
+            return hierarchy(handle);
+        }
+
+        /**
+         * Met à jour la profondeur de toute la descendance d'une entité
+         */
+        auto updateDepths(const Handle &root) -> void {
+            std::vector<Handle> pending{root};
+            while (!pending.empty()) {
+                const auto current(pending.back());
+                pending.pop_back();
+
+                const auto depth = hierarchy(current).depth;
+                for (auto child(hierarchy(current).first_child); child; child = hierarchy(*child).next_sibling) {
+                    hierarchy(*child).depth = depth + 1;
+                    pending.push_back(*child);
+                }
+            }
+        }
+
+        /**
+         * Retire une entité de la liste des enfants de son parent
+         */
+        auto unlink(CHierarchy &child) noexcept -> void {
+            auto &parent(hierarchy(*child.parent));
+
+            if (parent.first_child == child.self) {
+                parent.first_child = child.next_sibling;
+            } else {
+                auto previous(parent.first_child);
+                while (hierarchy(*previous).next_sibling != child.self) {
+                    previous = hierarchy(*previous).next_sibling;
+                }
+                hierarchy(*previous).next_sibling = child.next_sibling;
+            }
+
+            child.parent.reset();
+            child.next_sibling.reset();
+        }
+
+        /**
+         * Reconstruit le tableau des enfants trié par profondeur
+         */
+        auto rebuild() -> void {
+            std::erase_if(links_, [this](Link &link) {
+                if (!manager_.isHandleValid(link.entity) || !manager_.isAlive(link.entity)) return true;
+
+                const auto &h(hierarchy(link.entity));
+                if (!h.parent) return true;
+
+                link.parent = *h.parent;
+                link.depth = h.depth;
+                return false;
+            });
+
+            // Une entité détachée puis rattachée avant la reconstruction peut apparaître deux fois
+            const auto by_entity = [](const Link &link) { return link.entity.handleDataIndex; };
+            std::ranges::sort(links_, {}, by_entity);
+            const auto duplicates = std::ranges::unique(links_, {}, by_entity);
+            links_.erase(duplicates.begin(), duplicates.end());
+
+            std::ranges::stable_sort(links_, {}, &Link::depth);
+            dirty_ = false;
+        }
+
+        /**
+         * Observateur : la mort d'une entité tue ses enfants et la détache de son parent
+         */
+        auto onKilled(TManager &manager, const EntityIndex entity_index) -> void {
+            if (!manager.template hasComponent<CHierarchy>(entity_index)) return;
+
+            auto &h(manager.template getComponent<CHierarchy>(entity_index));
+
+            for (auto child(h.first_child); child; child = hierarchy(*child).next_sibling) {
+                manager.kill(*child);
+            }
+
+            if (h.parent && manager.isAlive(*h.parent)) {
+                unlink(h);
+            }
+
+            dirty_ = true;
+        }
+
+    public:
+        explicit Hierarchy(TManager &manager) : manager_{manager} {
+            manager_.template onKilled<&Hierarchy::onKilled>(*this);
+        }
+
+        ~Hierarchy() {
+            manager_.removeObservers(*this);
+        }
+
+        Hierarchy(const Hierarchy &) = delete;
+        Hierarchy &operator=(const Hierarchy &) = delete;
+
+        /**
+         * Attache une entité à un parent (le composant CHierarchy est ajouté si besoin).
+         * Une entité déjà attachée est d'abord détachée de son ancien parent.
+         *
+         * @param child Entité enfant
+         * @param parent Entité parent (ne doit pas être un descendant de child)
+         */
+        auto attach(const Handle &child, const Handle &parent) -> void {
+            assert(!(child == parent));
+
+            ensureHierarchy(parent);
+            auto &child_hierarchy(ensureHierarchy(child));
+
+            if (child_hierarchy.parent) {
+                unlink(child_hierarchy);
+            } else {
+                links_.push_back(Link{child, parent, 0});
+            }
+
+            // Pas de cycle : le parent ne doit pas descendre de l'enfant
+            assert([&] {
+                for (auto ancestor(hierarchy(parent).parent); ancestor; ancestor = hierarchy(*ancestor).parent) {
+                    if (*ancestor == child) return false;
+                }
+                return true;
+            }());
+
+            auto &parent_hierarchy(hierarchy(parent));
+            child_hierarchy.parent = parent;
+            child_hierarchy.next_sibling = parent_hierarchy.first_child;
+            child_hierarchy.depth = parent_hierarchy.depth + 1;
+            parent_hierarchy.first_child = child;
+
+            updateDepths(child);
+            dirty_ = true;
+        }
+
+        /**
+         * Détache une entité de son parent : elle devient une racine (avec sa descendance)
+         * @param child Entité à détacher
+         */
+        auto detach(const Handle &child) -> void {
+            auto &child_hierarchy(hierarchy(child));
+            if (!child_hierarchy.parent) return;
+
+            unlink(child_hierarchy);
+            child_hierarchy.depth = 0;
+
+            updateDepths(child);
+            dirty_ = true;
+        }
+
+        /**
+         * Reconstruit l'état interne depuis les composants CHierarchy du Manager, après un
+         * chargement de snapshot ou toute modification faite sans passer par la hiérarchie.
+         */
+        auto reset() -> void {
+            links_.clear();
+
+            const auto &const_manager(manager_);
+            for (EntityIndex entity_index{0}; entity_index < manager_.getEntityCount(); ++entity_index) {
+                if (!manager_.template hasComponent<CHierarchy>(entity_index)) continue;
+
+                const auto &h(const_manager.template getComponent<CHierarchy>(entity_index));
+                if (h.parent) links_.push_back(Link{h.self, *h.parent, h.depth});
+            }
+
+            dirty_ = true;
+        }
+
+        /**
+         * Récupère le parent d'une entité
+         * @param entity Entité
+         * @return Handle du parent, ou std::nullopt pour une racine
+         */
+        [[nodiscard]] auto parentOf(const Handle &entity) const noexcept -> std::optional<Handle> {
+            if (!manager_.template hasComponent<CHierarchy>(entity)) return std::nullopt;
+            return std::as_const(manager_).template getComponent<CHierarchy>(entity).parent;
+        }
+
+        /**
+         * Nombre d'entités ayant un parent
+         */
+        [[nodiscard]] auto size() noexcept -> std::size_t {
+            if (dirty_) rebuild();
+            return links_.size();
+        }
+
+        /**
+         * Propage les transformations des parents vers leurs enfants, par profondeur croissante.
+         *
+         * La propagation est incrémentale : un enfant n'est recalculé que si sa transformation
+         * locale, la transformation monde de son parent ou son rattachement a changé depuis
+         * last_run. Un enfant recalculé est marqué modifié, ce qui entraîne le recalcul de ses
+         * propres enfants dans le même balayage.
+         *
+         * @tparam TLocal Composant de transformation locale (relative au parent)
+         * @tparam TWorld Composant de transformation monde
+         * @tparam TCompose Fonction void(const TWorld &parent, const TLocal &local, TWorld &world)
+         * @param last_run Tick du dernier passage (mis à jour)
+         * @param compose Fonction de composition des transformations
+         */
+        template<typename TLocal, typename TWorld, typename TCompose>
+        auto propagate(ChangeTick &last_run, TCompose &&compose) -> void {
+            if (dirty_) rebuild();
+
+            const ChangeTick since(last_run);
+            const auto &const_manager(manager_);
+
+            for (const auto &link: links_) {
+                const auto entity_index(manager_.getEntityIndex(link.entity));
+                const auto parent_index(manager_.getEntityIndex(link.parent));
+
+                if (!manager_.isAlive(entity_index)) continue;
+
+                if (!manager_.template hasChanged<TLocal>(entity_index, since) &&
+                    !manager_.template hasChanged<TWorld>(parent_index, since) &&
+                    !manager_.template hasChanged<CHierarchy>(entity_index, since)) {
+                    continue;
+                }
+
+                compose(const_manager.template getComponent<TWorld>(parent_index),
+                        const_manager.template getComponent<TLocal>(entity_index),
+                        manager_.template getComponent<TWorld>(entity_index));
+            }
+
+            manager_.updateChangeTick(last_run);
+        }
+    };
+
+}
+
+#endif //ECS_HIERARCHY_H
@@ -5,13 +5,35 @@
 #ifndef ECS_MANAGER_H
 #define ECS_MANAGER_H
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <cassert>
-
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Broadphase.h"
+#include "Snapshot.h"
 #include "impl/ComponentStorage.h"
 #include "impl/Entity.h"
 #include "impl/HandleData.h"
+#include "impl/Observers.h"
+#include "impl/QueryRecorder.h"
+#include "impl/SharedPool.h"
 #include "impl/SignatureBitsetsStorage.h"
+#include "impl/View.h"
+#include "ManagerStats.h"
+#include "tools/ForEachType.h"
+#include "tools/RoaringBitmap.h"
+#include "tools/TypeName.h"
 
 namespace ecs {
     /**
@@ -32,14 +54,51 @@ namespace ecs {
         using HandleData = impl::HandleData;
         using SignatureBitsetsStorage = impl::SignatureBitsetsStorage<Settings>;
         using ComponentStorage = impl::ComponentStorage<Settings>;
+        using Observers = impl::Observers<Settings, ThisType>;
+        // Resources = std::tuple<R0, R1, R2, ...>
+        using Resources = tools::rename_t<std::tuple, typename Settings::ResourceList>;
+        // SharedList = TypeList<ecs::Shared<T0>, ecs::Shared<T1>, ...> (composants partagés de la ComponentList)
+        using SharedList = tools::filter_t<typename Settings::ComponentList, impl::IsShared>;
+        using SharedPools = tools::rename_t<impl::SharedPools, SharedList>;
+
+        // Les vues ont besoin d'accéder directement aux entités et aux composants
+        template<typename, typename, typename>
+        friend class impl::View;
+
+        // La création concurrente réserve directement des plages d'entités
+        template<typename>
+        friend class ConcurrentCreation;
 
         std::size_t capacity{0}, size{0}, sizeNext{0};
 
+        /**
+         * Nombre d'agrandissements du stockage (voir stats())
+         */
+        std::size_t growthCount{0};
+
+        /**
+         * Répertoire des colonnes projetées (vide si les colonnes sont en mémoire, voir mapColumns)
+         */
+        std::filesystem::path mappedDirectory;
+
+        /**
+         * Tick courant utilisé pour horodater les ajouts et modifications de composants.
+         * Il avance à chaque requête filtrée (ecs::Changed<T>, ecs::Added<T>).
+         */
+        ChangeTick changeTick{1u};
+
         /**
          * Stockage des entités
          */
         std::vector<Entity> entities;
 
+        /**
+         * Entités actives : un bit par entité, indexé comme entities. Les requêtes ignorent les
+         * entités désactivées, qui restent vivantes et conservent leurs composants.
+         */
+        std::vector<std::uint64_t> enabledBits;
+        static constexpr std::size_t EnabledWordBits{64};
+
         /**
          * Stockage des bitset des signatures
          */
@@ -53,6 +112,74 @@ namespace ecs {
         // Handle data will be stored in a vector, like entities.
         std::vector<HandleData> handleData;
 
+        /**
+         * Tampons réutilisés par forPairsMatching pour éviter une allocation à chaque appel
+         */
+        std::vector<EntityIndex> pairEntitiesA, pairEntitiesB;
+
+        /**
+         * Tampon réutilisé par killIf sur un groupe : résultat du prédicat pour chaque membre
+         */
+        std::vector<std::uint8_t> killMask;
+
+        /**
+         * Observateurs et événements en attente de notification
+         */
+        Observers observers;
+
+        /**
+         * Création concurrente en cours (voir ConcurrentCreation)
+         */
+        bool concurrentCreation{false};
+
+        /**
+         * Groupes possédants (voir forGroup) : les membres du groupe g occupent les emplacements
+         * [0, groupSizes[g]) de toutes les colonnes. dataOwners donne l'entité de chaque
+         * emplacement ; les entités dont la composition a changé sont reclassées au refresh.
+         * Vides si les Settings ne déclarent aucun groupe.
+         */
+        static constexpr std::size_t GroupCount{static_cast<std::size_t>(Settings::groupCount())};
+        std::array<std::size_t, GroupCount> groupSizes{};
+        std::vector<EntityIndex> dataOwners;
+        std::vector<EntityIndex> pendingGroupUpdates;
+
+        /**
+         * Statistiques des requêtes par signature (vides si ECS_QUERY_STATS vaut 0)
+         */
+        impl::QueryRecorder<static_cast<std::size_t>(Settings::signatureCount())> queryRecorder;
+
+        /**
+         * Valeurs des composants partagés (ecs::Shared<T>), une table par type
+         */
+        static constexpr bool HasShared{tools::size_v<SharedList> > 0};
+        SharedPools sharedPools;
+
+        /**
+         * Entités portant chaque tag (index dans l'ordre de la TagList), en plus du bit de
+         * l'entité : les requêtes dont la signature contient un tag rare ne parcourent que ses
+         * porteurs. Mis à jour par addTag / delTag et au refresh (entités tuées ou déplacées).
+         */
+        static constexpr std::size_t TagCount{static_cast<std::size_t>(Settings::tagCount())};
+        std::array<tools::RoaringBitmap, TagCount> tagSets;
+
+        // Bits des tags dans le bitset d'une entité : un déplacement sans tag ne coûte qu'un test au refresh
+        static inline const typename Settings::Bitset TagBits{[] {
+            typename Settings::Bitset bits;
+            for (std::size_t tag{0}; tag < TagCount; ++tag) bits.set(static_cast<std::size_t>(Settings::componentCount()) + tag);
+            return bits;
+        }()};
+
+        /**
+         * Une requête parcourt les porteurs de son tag le plus rare s'ils représentent moins
+         * d'une entité sur SparseTagRatio, toutes les entités sinon
+         */
+        static constexpr std::size_t SparseTagRatio{16};
+
+        /**
+         * Ressources du monde (une instance par type, hors entités)
+         */
+        Resources resources;
+
         /**
          * Fonction permettant de faire "grossir" la capacité de stockage des
          * entités.
@@ -63,6 +190,7 @@ namespace ecs {
             assert(new_capacity > capacity);
 
             entities.resize(new_capacity);
+            enabledBits.resize((new_capacity + EnabledWordBits - 1) / EnabledWordBits, 0);
             components.grow(new_capacity);
 
             // Do not forget to grow the new container.
@@ -93,7 +221,15 @@ namespace ecs {
                 h.entityIndex = i;
             }
 
+            if constexpr (GroupCount > 0) {
+                dataOwners.resize(new_capacity);
+                for (auto i(capacity); i < new_capacity; ++i) {
+                    dataOwners[i] = i;
+                }
+            }
+
             capacity = new_capacity;
+            ++growthCount;
         }
 
         /**
@@ -196,13 +332,84 @@ namespace ecs {
         }
 
         void kill(const EntityIndex entity_index) noexcept {
-            getEntity(entity_index).alive = false;
+            auto &entity(getEntity(entity_index));
+            if (!entity.alive) return;
+
+            entity.alive = false;
+            observers.killed(entity_index);
+            groupChanged(entity_index);
         }
 
         void kill(const Handle &handle) noexcept {
             kill(getEntityIndex(handle));
         }
 
+        /**
+         * Indique si une entité est active (par défaut à la création)
+         * @param entity_index Index de l'entité
+         * @return false si l'entité a été désactivée par setEnabled
+         */
+        [[nodiscard]] auto isEnabled(const EntityIndex entity_index) const noexcept -> bool {
+            assert(sizeNext > entity_index);
+            return (enabledBits[entity_index.get() / EnabledWordBits] >> (entity_index.get() % EnabledWordBits)) & 1u;
+        }
+
+        [[nodiscard]] auto isEnabled(const Handle &handle) const noexcept -> bool {
+            return isEnabled(getEntityIndex(handle));
+        }
+
+        /**
+         * Active ou désactive une entité (entité en attente d'apparition, hors de la vue, ...).
+         *
+         * Une entité désactivée ne correspond plus à aucune signature : elle est ignorée par
+         * matchesSignature et donc par toutes les requêtes (forEntitiesMatching, view,
+         * forChunksMatching, forPairsMatching). Elle reste vivante, conserve ses composants et
+         * ses handles, et reste accessible par forDisabledMatching. Contrairement à kill, aucun
+         * observateur n'est notifié et le changement est immédiat (pas besoin de refresh).
+         *
+         * @param entity_index Index de l'entité
+         * @param enabled true pour activer, false pour désactiver
+         */
+        auto setEnabled(const EntityIndex entity_index, const bool enabled) noexcept -> void {
+            assert(sizeNext > entity_index);
+            setEnabledBit(entity_index, enabled);
+            groupChanged(entity_index);
+        }
+
+        auto setEnabled(const Handle &handle, const bool enabled) noexcept -> void {
+            setEnabled(getEntityIndex(handle), enabled);
+        }
+
+        /**
+         * Active ou désactive une plage d'entités consécutives, par mots de 64 bits
+         *
+         * @param first Index de la première entité
+         * @param count Nombre d'entités consécutives
+         * @param enabled true pour activer, false pour désactiver
+         */
+        auto setEnabled(const EntityIndex first, const std::size_t count, const bool enabled) noexcept -> void {
+            assert(first.get() + count <= sizeNext);
+
+            auto index(first.get());
+            const auto last(first.get() + count);
+            while (index < last) {
+                const auto bit(index % EnabledWordBits);
+                const auto bits(std::min(EnabledWordBits - bit, last - index));
+                const auto mask((bits == EnabledWordBits ? ~std::uint64_t{0} : (std::uint64_t{1} << bits) - 1) << bit);
+
+                auto &word(enabledBits[index / EnabledWordBits]);
+                word = enabled ? word | mask : word & ~mask;
+                index += bits;
+            }
+
+            if constexpr (GroupCount > 0) {
+                if (concurrentCreation) return;
+                for (EntityIndex entity_index{first}; entity_index < last; ++entity_index) {
+                    groupChanged(entity_index);
+                }
+            }
+        }
+
         template<typename TTag>
         [[nodiscard]] auto hasTag(const EntityIndex entity_index) const noexcept -> bool {
             static_assert(Settings::template isTag<TTag>(), "TTag must be a Tag");
@@ -215,10 +422,28 @@ namespace ecs {
             return hasTag<TTag>(getEntityIndex(handle));
         }
 
+        /**
+         * Index des entités portant le tag, créées depuis le dernier refresh comprises (les
+         * entités tuées en sont retirées au refresh). Permet de combiner des tags par
+         * intersection ou union (tools::RoaringBitmap::intersect / unite).
+         */
+        template<typename TTag>
+        [[nodiscard]] auto taggedEntities() const noexcept -> const tools::RoaringBitmap & {
+            static_assert(Settings::template isTag<TTag>(), "TTag must be a Tag");
+            return tagSets[tagIndex<TTag>()];
+        }
+
         template<typename TTag>
         auto addTag(const EntityIndex entity_index) noexcept -> void {
             static_assert(Settings::template isTag<TTag>(), "TTag must be a Tag");
-            getEntity(entity_index).bitset[Settings::template tagBit<TTag>()] = true;
+            auto &&bit(getEntity(entity_index).bitset[Settings::template tagBit<TTag>()]);
+            if (bit) return;
+
+            bit = true;
+            // Les porteurs des tags posés pendant une création concurrente sont enregistrés à sa fin
+            if (!concurrentCreation) tagSets[tagIndex<TTag>()].add(static_cast<std::uint32_t>(entity_index.get()));
+            observers.template tagAdded<TTag>(entity_index);
+            groupChanged<TTag>(entity_index);
         }
 
         template<typename TTag>
@@ -230,7 +455,11 @@ namespace ecs {
         template<typename TTag>
         auto delTag(const EntityIndex entity_index) noexcept -> void {
             static_assert(Settings::template isTag<TTag>(), "TTag must be a Tag");
-            getEntity(entity_index).bitset[Settings::template tagBit<TTag>()] = false;
+            auto &&bit(getEntity(entity_index).bitset[Settings::template tagBit<TTag>()]);
+            if (bit && !concurrentCreation) tagSets[tagIndex<TTag>()].remove(static_cast<std::uint32_t>(entity_index.get()));
+
+            bit = false;
+            groupChanged<TTag>(entity_index);
         }
 
         template<typename TTag>
@@ -254,13 +483,9 @@ namespace ecs {
         template<typename TComponent, typename... TArgs>
         auto addComponent(const EntityIndex entity_index, TArgs &&... mXs) noexcept -> TComponent & {
             static_assert(Settings::template isComponent<TComponent>(), "TComponent must be a Component");
+            static_assert(!impl::IsShared<TComponent>::value, "Use setShared for a shared component");
 
-            auto &e(getEntity(entity_index));
-            e.bitset[Settings::template componentBit<TComponent>()] = true;
-
-            auto &c(components.template getComponent<TComponent>(e.dataIndex));
-            new(&c) TComponent(std::forward<TArgs>(mXs)...);
-            return c;
+            return emplaceComponent<TComponent>(entity_index, std::forward<TArgs>(mXs)...);
         }
 
         template<typename TComponent, typename... TArgs>
@@ -269,14 +494,40 @@ namespace ecs {
             return addComponent<TComponent>(getEntityIndex(handle), std::forward<TArgs>(mXs)...);
         }
 
+    private:
+        template<typename TComponent, typename... TArgs>
+        auto emplaceComponent(const EntityIndex entity_index, TArgs &&... mXs) noexcept -> TComponent & {
+            auto &e(getEntity(entity_index));
+            if (!e.bitset[Settings::template componentBit<TComponent>()]) {
+                e.bitset[Settings::template componentBit<TComponent>()] = true;
+                observers.template componentAdded<TComponent>(entity_index);
+                groupChanged<TComponent>(entity_index);
+            }
+
+            auto &c(components.template getComponent<TComponent>(e.dataIndex));
+            new(&c) TComponent(std::forward<TArgs>(mXs)...);
+
+            auto &ticks(components.template getTicks<TComponent>(e.dataIndex));
+            ticks.added = ticks.changed = changeTick;
+
+            return c;
+        }
+
+    public:
+
         // `getComponent` will simply return a reference to the
         // component, after asserting its existence.
+        // Mutable access: the component is considered changed.
         template<typename TComponent>
         auto getComponent(const EntityIndex entity_index) noexcept -> TComponent & {
             static_assert(Settings::template isComponent<TComponent>(), "TComponent must be a Component");
+            static_assert(!impl::IsShared<TComponent>::value, "Use setShared or updateShared for a shared component");
             assert(hasComponent<TComponent>(entity_index));
 
-            return components.template getComponent<TComponent>(getEntity(entity_index).dataIndex);
+            const auto &data_index(getEntity(entity_index).dataIndex);
+            components.template getTicks<TComponent>(data_index).changed = changeTick;
+
+            return components.template getComponent<TComponent>(data_index);
         }
 
         template<typename TComponent>
@@ -285,10 +536,127 @@ namespace ecs {
             return getComponent<TComponent>(getEntityIndex(handle));
         }
 
+        // Const access: the component is not considered changed.
+        template<typename TComponent>
+        [[nodiscard]] auto getComponent(const EntityIndex entity_index) const noexcept -> const TComponent & {
+            static_assert(Settings::template isComponent<TComponent>(), "TComponent must be a Component");
+            assert(hasComponent<TComponent>(entity_index));
+
+            return components.template getComponent<TComponent>(getEntity(entity_index).dataIndex);
+        }
+
+        template<typename TComponent>
+        [[nodiscard]] auto getComponent(const Handle &handle) const noexcept -> const TComponent & {
+            static_assert(Settings::template isComponent<TComponent>(), "TComponent must be a Component");
+            return getComponent<TComponent>(getEntityIndex(handle));
+        }
+
+        /**
+         * Indique explicitement qu'un composant a été modifié.
+         * À utiliser après une modification faite au travers d'une itération (forEntitiesMatching,
+         * forChunksMatching, view), qui ne marque pas les composants qu'elle fournit.
+         *
+         * @tparam TComponent Type de composant modifié
+         * @param entity_index Index de l'entité
+         */
+        template<typename TComponent>
+        auto markChanged(const EntityIndex entity_index) noexcept -> void {
+            static_assert(Settings::template isComponent<TComponent>(), "TComponent must be a Component");
+            assert(hasComponent<TComponent>(entity_index));
+
+            components.template getTicks<TComponent>(getEntity(entity_index).dataIndex).changed = changeTick;
+        }
+
+        template<typename TComponent>
+        auto markChanged(const Handle &handle) noexcept -> void {
+            static_assert(Settings::template isComponent<TComponent>(), "TComponent must be a Component");
+            markChanged<TComponent>(getEntityIndex(handle));
+        }
+
+        /**
+         * Indique explicitement qu'un composant a été modifié pour une plage d'entités
+         * (typiquement un bloc fourni par forChunksMatching).
+         *
+         * @tparam TComponent Type de composant modifié
+         * @param first Index de la première entité
+         * @param count Nombre d'entités consécutives
+         */
+        template<typename TComponent>
+        auto markChanged(const EntityIndex first, const std::size_t count) noexcept -> void {
+            static_assert(Settings::template isComponent<TComponent>(), "TComponent must be a Component");
+
+            for (auto i(first.get()); i < first.get() + count; ++i) {
+                markChanged<TComponent>(EntityIndex{i});
+            }
+        }
+
+        /**
+         * Récupère une ressource du monde.
+         *
+         * Accès direct en O(1), sans indirection handle -> entité -> composant. Les ressources
+         * sont construites par défaut avec le Manager et ne sont pas affectées par clear().
+         *
+         * @tparam TResource Type de ressource
+         * @return Référence vers la ressource
+         */
+        template<typename TResource>
+        auto resource() noexcept -> TResource & {
+            static_assert(Settings::template isResource<TResource>(), "TResource must be a Resource");
+            return std::get<TResource>(resources);
+        }
+
+        template<typename TResource>
+        [[nodiscard]] auto resource() const noexcept -> const TResource & {
+            static_assert(Settings::template isResource<TResource>(), "TResource must be a Resource");
+            return std::get<TResource>(resources);
+        }
+
+        /**
+         * Récupère le tick courant de détection des changements
+         * @return Tick courant
+         */
+        [[nodiscard]] auto getChangeTick() const noexcept -> ChangeTick {
+            return changeTick;
+        }
+
+        /**
+         * Indique si un composant d'une entité a été modifié depuis un tick donné
+         *
+         * @tparam TComponent Type de composant
+         * @param entity_index Index de l'entité
+         * @param since Tick de référence (typiquement le last_run de l'appelant)
+         * @return true si le composant est présent et modifié après since
+         */
+        template<typename TComponent>
+        [[nodiscard]] auto hasChanged(const EntityIndex entity_index, const ChangeTick since) const noexcept -> bool {
+            return passesChangeFilter<Changed<TComponent>>(entity_index, since);
+        }
+
+        /**
+         * Termine un passage de détection des changements fait à la main (avec hasChanged) :
+         * last_run reçoit le tick courant, puis le tick avance.
+         *
+         * @param last_run Tick du dernier passage de l'appelant
+         */
+        auto updateChangeTick(ChangeTick &last_run) noexcept -> void {
+            last_run = changeTick;
+            ++changeTick;
+        }
+
         template<typename TComponent>
         auto delComponent(const EntityIndex entity_index) noexcept -> void {
             static_assert(Settings::template isComponent<TComponent>(), "TComponent must be a Component");
-            getEntity(entity_index).bitset[Settings::template componentBit<TComponent>()] = false;
+            auto &&bit(getEntity(entity_index).bitset[Settings::template componentBit<TComponent>()]);
+            if (!bit) return;
+
+            if constexpr (impl::IsShared<TComponent>::value) {
+                sharedPools.template get<typename TComponent::Type>().release(
+                    components.template getComponent<TComponent>(getEntity(entity_index).dataIndex).index);
+            }
+
+            bit = false;
+            observers.template componentRemoved<TComponent>(entity_index);
+            groupChanged<TComponent>(entity_index);
         }
 
         template<typename TComponent>
@@ -297,7 +665,92 @@ namespace ecs {
             delComponent<TComponent>(getEntityIndex(handle));
         }
 
+        /**
+         * Associe une valeur partagée à une entité (composant ecs::Shared<T>).
+         *
+         * Si une entité référence déjà une valeur égale, elle est réutilisée : l'entité ne stocke
+         * que son index. La valeur précédente de l'entité est libérée ; une valeur n'est
+         * détruite que lorsque plus aucune entité ne la référence (delComponent, ou refresh
+         * suivant la mort de l'entité). Interdit pendant une création concurrente.
+         *
+         * @tparam T Type de la valeur partagée (ecs::Shared<T> doit être un composant)
+         * @param entity_index Index de l'entité
+         * @param value Valeur à partager
+         * @return Référence vers la valeur partagée
+         */
+        template<typename T>
+        auto setShared(const EntityIndex entity_index, const T &value) -> const T & {
+            static_assert(Settings::template isComponent<Shared<T>>(), "Shared<T> must be a Component");
+            assert(!concurrentCreation && "Shared values cannot be set during a concurrent creation");
+
+            auto &pool(sharedPools.template get<T>());
+            // Acquisition avant libération : une valeur inchangée n'est pas recréée
+            const auto index(pool.acquire(value));
+            if (hasComponent<Shared<T>>(entity_index)) {
+                pool.release(components.template getComponent<Shared<T>>(getEntity(entity_index).dataIndex).index);
+            }
+
+            emplaceComponent<Shared<T>>(entity_index, index);
+            return pool.get(index);
+        }
+
+        template<typename T>
+        auto setShared(const Handle &handle, const T &value) -> const T & {
+            return setShared<T>(getEntityIndex(handle), value);
+        }
+
+        /**
+         * Récupère la valeur partagée d'une entité
+         *
+         * @tparam T Type de la valeur partagée
+         * @param entity_index Index de l'entité (possédant ecs::Shared<T>)
+         * @return Référence constante vers la valeur, commune à toutes les entités qui la partagent
+         */
+        template<typename T>
+        [[nodiscard]] auto getShared(const EntityIndex entity_index) const noexcept -> const T & {
+            static_assert(Settings::template isComponent<Shared<T>>(), "Shared<T> must be a Component");
+            return sharedPools.template get<T>().get(getComponent<Shared<T>>(entity_index).index);
+        }
+
+        template<typename T>
+        [[nodiscard]] auto getShared(const Handle &handle) const noexcept -> const T & {
+            return getShared<T>(getEntityIndex(handle));
+        }
+
+        /**
+         * Modifie la valeur partagée d'une entité : toutes les entités qui la partagent voient la
+         * modification. Les horodatages des composants ne sont pas mis à jour (Changed<Shared<T>>
+         * ne détecte que le changement de valeur référencée par setShared).
+         *
+         * @tparam T Type de la valeur partagée
+         * @tparam TF Type de la fonction (void mFunction(T &))
+         * @param entity_index Index d'une entité référençant la valeur
+         * @param mFunction Fonction modifiant la valeur
+         */
+        template<typename T, typename TF>
+        auto updateShared(const EntityIndex entity_index, TF &&mFunction) -> void {
+            static_assert(Settings::template isComponent<Shared<T>>(), "Shared<T> must be a Component");
+            mFunction(sharedPools.template get<T>().get(std::as_const(*this).template getComponent<Shared<T>>(entity_index).index));
+        }
+
+        template<typename T, typename TF>
+        auto updateShared(const Handle &handle, TF &&mFunction) -> void {
+            updateShared<T>(getEntityIndex(handle), std::forward<TF>(mFunction));
+        }
+
+        /**
+         * Nombre de valeurs distinctes d'un composant partagé référencées par des entités
+         *
+         * @tparam T Type de la valeur partagée
+         */
+        template<typename T>
+        [[nodiscard]] auto sharedCount() const noexcept -> std::size_t {
+            static_assert(Settings::template isComponent<Shared<T>>(), "Shared<T> must be a Component");
+            return sharedPools.template get<T>().liveCount();
+        }
+
         auto createIndex() -> EntityIndex {
+            assert(!concurrentCreation && "Use ConcurrentCreation::Creator during a concurrent creation");
             growIfNeeded();
             EntityIndex freeIndex(sizeNext++);
 
@@ -305,6 +758,7 @@ namespace ecs {
             auto &entity(entities[freeIndex]);
             entity.alive = true;
             entity.bitset.reset();
+            setEnabledBit(freeIndex, true);
 
             return freeIndex;
         }
@@ -318,7 +772,14 @@ namespace ecs {
         auto createHandle() -> Handle {
             // Let's start by creating an entity with
             // `createIndex()`, and storing the result.
-            auto freeIndex(createIndex());
+            return bindHandle(createIndex());
+        }
+
+    private:
+        /**
+         * Associe un nouveau handle à une entité venant d'être créée
+         */
+        auto bindHandle(const EntityIndex freeIndex) noexcept -> Handle {
             assert(isAlive(freeIndex));
 
             // We'll need to "match" the new entity
@@ -348,6 +809,76 @@ namespace ecs {
             return h;
         }
 
+        /**
+         * Début d'une création concurrente : garantit la capacité pour count entités de plus, puis
+         * expose toute la capacité (sizeNext = capacity) pour que les créateurs puissent y
+         * initialiser des entités sans modifier l'état partagé.
+         *
+         * @return Index de la première entité réservable
+         */
+        auto beginConcurrentCreation(const std::size_t count) -> std::size_t {
+            assert(!concurrentCreation);
+            if (capacity < sizeNext + count) growTo(sizeNext + count);
+
+            const auto first(sizeNext);
+            sizeNext = capacity;
+            // Les bits d'activation sont mis en place ici : les créateurs n'écrivent jamais dans
+            // un mot partagé avec un autre thread. Les groupes ne sont pas concernés : seules les
+            // entités effectivement créées y sont reclassées (voir endConcurrentCreation).
+            concurrentCreation = true;
+            setEnabled(EntityIndex{first}, capacity - first, true);
+
+            observers.suspend(true);
+            return first;
+        }
+
+        /**
+         * Initialise une entité réservée par un créateur (appelé depuis n'importe quel thread)
+         */
+        auto initConcurrentEntity(const EntityIndex entity_index) noexcept -> Handle {
+            auto &entity(entities[entity_index]);
+            entity.alive = true;
+            entity.bitset.reset();
+
+            return bindHandle(entity_index);
+        }
+
+        /**
+         * Fin d'une création concurrente : les entités non réservées sont rendues et les
+         * événements des entités créées (composants et tags ajoutés) sont enregistrés pour le
+         * prochain refresh.
+         *
+         * @param first Index de la première entité réservable
+         * @param end Fin des entités réservées
+         */
+        auto endConcurrentCreation(const std::size_t first, const std::size_t end) -> void {
+            assert(concurrentCreation);
+            sizeNext = std::min(end, capacity);
+            concurrentCreation = false;
+            observers.suspend(false);
+
+            for (EntityIndex entity_index{first}; entity_index < sizeNext; ++entity_index) {
+                const auto &entity(entities[entity_index]);
+                if (!entity.alive) continue;
+
+                groupChanged(entity_index);
+
+                tools::for_each_type<typename Settings::ComponentList>([this, &entity, entity_index]<typename TComponent>() {
+                    if (entity.bitset[Settings::template componentBit<TComponent>()]) {
+                        observers.template componentAdded<TComponent>(entity_index);
+                    }
+                });
+                tools::for_each_type<typename Settings::TagList>([this, &entity, entity_index]<typename TTag>() {
+                    if (!entity.bitset[Settings::template tagBit<TTag>()]) return;
+
+                    tagSets[tagIndex<TTag>()].add(static_cast<std::uint32_t>(entity_index.get()));
+                    observers.template tagAdded<TTag>(entity_index);
+                });
+            }
+        }
+
+    public:
+
         void clear() noexcept {
             // Let's re-initialize handles during `clear()`.
 
@@ -363,55 +894,347 @@ namespace ecs {
                 counter = 0;
                 entity_index = i;
             }
+            std::ranges::fill(enabledBits, 0);
+
+            if constexpr (GroupCount > 0) {
+                for (auto i(0u); i < capacity; ++i) {
+                    dataOwners[i] = i;
+                }
+                groupSizes.fill(0);
+                pendingGroupUpdates.clear();
+            }
+
+            if constexpr (HasShared) {
+                sharedPools.clear();
+            }
+
+            for (auto &tag_set: tagSets) {
+                tag_set.clear();
+            }
 
             size = sizeNext = 0;
+            observers.clearPending();
         }
 
         void refresh() noexcept {
+            // Les observateurs sont notifiés avant le compactage : les index des entités
+            // (y compris celles tuées) sont encore valides
+            if (observers.hasPending()) {
+                observers.dispatch(*this);
+            }
+
+            // Reclassement des entités dont la composition a changé (entités mortes comprises)
+            if constexpr (GroupCount > 0) {
+                for (const auto entity_index: pendingGroupUpdates) {
+                    // Entité rendue depuis (fin d'une création concurrente, par exemple)
+                    if (sizeNext > entity_index) updateGroups(entity_index);
+                }
+                pendingGroupUpdates.clear();
+            }
+
             if (sizeNext == 0) {
                 size = 0;
                 return;
             }
 
             size = sizeNext = refreshImpl();
+
+            // Les entités mortes occupent désormais la fin du tableau
+            for (auto &tag_set: tagSets) {
+                tag_set.removeFrom(static_cast<std::uint32_t>(size));
+            }
         }
 
         /**
-         * Fonction permettant de déterminer si une entité correspond à une signature.
+         * Écrit une image binaire complète du Manager (voir Snapshot.h) à la fin de blob.
          *
-         * La fonction applique un et binaire entre le bitset de l'entité et le bitset
-         * de la signature.
+         * Les entités, handles, colonnes de composants copiables, horodatages et ressources
+         * copiables sont écrits en bloc ; les autres types passent par leur SnapshotCodec.
+         * Les événements en attente et les observateurs ne font pas partie de l'image.
          *
-         * @tparam TSignature Signature à utiliser pour la vérification
-         * @param entity_index Index de l'entité à contrôler
-         * @return True si l'entité colle avec la signature
+         * @param blob Tampon de destination (le snapshot est ajouté à la suite)
          */
-        template<typename TSignature>
-        [[nodiscard]] auto matchesSignature(const EntityIndex entity_index) const noexcept -> bool {
-            static_assert(Settings::template isSignature<TSignature>(), "TSignature must be a Signature");
-
-            const auto &entityBitset(getEntity(entity_index).bitset);
-            const auto &signatureBitset(signatureBitsets.template getSignatureBitset<TSignature>());
-
-            return (signatureBitset & entityBitset) == signatureBitset;
+        auto saveSnapshot(std::vector<std::byte> &blob) const -> void {
+            writeSnapshot(blob, false);
         }
 
         /**
-         * Méthode permettant d'appliquer une fonction sur toutes les entités
+         * Restaure le Manager depuis une image produite par saveSnapshot.
          *
-         * @tparam TF Type de la fonction à appliquer (void mFunction(EntityIndex index))
-         * @param mFunction Fonction à appliquer
+         * Les colonnes copiables sont relues par un simple memcpy depuis le blob, qui peut donc
+         * provenir directement d'un fichier projeté en mémoire. Aucun observateur n'est notifié :
+         * les systèmes dépendant de l'état du monde (ecs::Hierarchy, ...) doivent être
+         * réinitialisés par l'appelant.
+         *
+         * Une image sans colonnes (SnapshotExternalColumns, voir saveMapped) n'est acceptée que
+         * si les colonnes du Manager sont projetées : leur contenu est alors conservé.
+         *
+         * @param blob Image à restaurer (version et structure des Settings vérifiées)
+         * @return false si l'image est invalide : le Manager est laissé intact si l'en-tête est
+         *         rejeté, vidé (clear()) si l'image est tronquée
          */
-        template<typename TF>
-        auto forEntities(TF &&mFunction) -> void {
-            for (EntityIndex entity_index{0}; entity_index < size; ++entity_index) {
-                mFunction(entity_index);
+        auto loadSnapshot(const std::span<const std::byte> blob) -> bool {
+            SnapshotReader reader(blob);
+
+            SnapshotHeader header{};
+            if (!reader.read(header) || !isValidHeader(header, blob.size()) ||
+                ((header.flags & SnapshotExternalColumns) != 0 && !isMapped())) {
+                return false;
             }
-        }
 
-        /**
-         * Méthode permettant d'itérer sur toutes les entités correspondant à la signature.
-         *
+            const auto saved_capacity(static_cast<std::size_t>(header.capacity));
+            const auto external((header.flags & SnapshotExternalColumns) != 0);
+
+            clear();
+            if (saved_capacity > capacity) growTo(saved_capacity);
+
+            reader.align();
+            reader.readBytes(entities.data(), saved_capacity * sizeof(Entity));
+            reader.readBytes(handleData.data(), saved_capacity * sizeof(HandleData));
+            reader.readBytes(enabledBits.data(),
+                             (saved_capacity + EnabledWordBits - 1) / EnabledWordBits * sizeof(std::uint64_t));
+
+            size = static_cast<std::size_t>(header.size);
+            sizeNext = static_cast<std::size_t>(header.sizeNext);
+
+            tools::for_each_type<typename Settings::ComponentList>([this, &reader, saved_capacity, external]<typename TComponent>() {
+                reader.align();
+                if constexpr (BulkSnapshotable<TComponent>) {
+                    if (!external) {
+                        reader.readBytes(components.template data<TComponent>(), saved_capacity * sizeof(TComponent));
+                    }
+                } else {
+                    for (EntityIndex entity_index{0}; entity_index < sizeNext && !reader.failed(); ++entity_index) {
+                        if (!hasComponent<TComponent>(entity_index)) continue;
+                        SnapshotCodec<TComponent>::read(
+                            reader, components.template getComponent<TComponent>(getEntity(entity_index).dataIndex));
+                    }
+                }
+                if (!external) {
+                    reader.readBytes(components.template ticksData<TComponent>(), saved_capacity * sizeof(impl::ComponentTicks));
+                }
+            });
+
+            tools::for_each_type<typename Settings::ResourceList>([this, &reader]<typename TResource>() {
+                if constexpr (BulkSnapshotable<TResource>) {
+                    reader.read(resource<TResource>());
+                } else {
+                    SnapshotCodec<TResource>::read(reader, resource<TResource>());
+                }
+            });
+
+            if (!sharedPools.load(reader) || reader.failed()) {
+                clear();
+                return false;
+            }
+
+            changeTick = header.changeTick;
+            rebuildGroups();
+            rebuildTagSets();
+            return true;
+        }
+
+        /**
+         * Projette les colonnes depuis des fichiers d'un répertoire (créé si besoin) : le système
+         * charge alors les composants à la demande, et le stockage grandit en étendant les
+         * fichiers (avec une indication de pages géantes si elle est disponible).
+         *
+         * Sont projetées les colonnes des composants copiables en bloc (BulkSnapshotable) et les
+         * horodatages de tous les composants ; leur contenu actuel est copié dans les fichiers,
+         * qui sont remplacés. Les autres colonnes restent en mémoire. Plateformes POSIX
+         * uniquement (tools::MappedFile::Supported).
+         *
+         * @param directory Répertoire des fichiers de colonnes
+         * @return false si un fichier ne peut être projeté (les colonnes déjà projetées le restent)
+         */
+        auto mapColumns(const std::filesystem::path &directory) -> bool {
+            return mapAllColumns(directory, false);
+        }
+
+        /**
+         * Indique si les colonnes sont projetées depuis des fichiers (voir mapColumns)
+         */
+        [[nodiscard]] auto isMapped() const noexcept -> bool {
+            auto mapped(true);
+            tools::for_each_type<typename Settings::ComponentList>([this, &mapped]<typename TComponent>() {
+                mapped = mapped && components.template isMapped<TComponent>();
+            });
+            return mapped;
+        }
+
+        /**
+         * Enregistre un monde dont les colonnes sont projetées : les colonnes sont écrites dans
+         * leurs fichiers, puis le reste de l'image (entités, handles, composants non copiables,
+         * ressources) dans le fichier world.snapshot du même répertoire.
+         *
+         * @return false si les colonnes ne sont pas projetées ou si l'écriture a échoué
+         */
+        auto saveMapped() const -> bool {
+            if (!isMapped()) return false;
+
+            auto synced(true);
+            tools::for_each_type<typename Settings::ComponentList>([this, &synced]<typename TComponent>() {
+                synced = components.template sync<TComponent>() && synced;
+            });
+            if (!synced) return false;
+
+            std::vector<std::byte> blob;
+            writeSnapshot(blob, true);
+
+            std::ofstream file(mappedDirectory / "world.snapshot", std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char *>(blob.data()), static_cast<std::streamsize>(blob.size()));
+            return file.good();
+        }
+
+        /**
+         * Rouvre un monde enregistré par saveMapped : les colonnes sont projetées depuis leurs
+         * fichiers sans être relues (le système les chargera à la demande), seul world.snapshot
+         * est lu.
+         *
+         * L'en-tête de world.snapshot et la taille de chaque fichier de colonne sont vérifiés
+         * avant toute projection.
+         *
+         * @param directory Répertoire passé à mapColumns lors de l'enregistrement
+         * @return false si le monde ne peut être rouvert : le Manager est laissé intact si une
+         *         vérification échoue, vidé (clear()) si la projection ou le chargement échoue
+         *         ensuite
+         */
+        auto openMapped(const std::filesystem::path &directory) -> bool {
+            std::ifstream file(directory / "world.snapshot", std::ios::binary | std::ios::ate);
+            if (!file) return false;
+
+            std::vector<std::byte> blob(static_cast<std::size_t>(file.tellg()));
+            file.seekg(0);
+            if (!file.read(reinterpret_cast<char *>(blob.data()), static_cast<std::streamsize>(blob.size()))) {
+                return false;
+            }
+
+            SnapshotReader reader(blob);
+            SnapshotHeader header{};
+            if (!reader.read(header) || !isValidHeader(header, blob.size()) ||
+                (header.flags & SnapshotExternalColumns) == 0) {
+                return false;
+            }
+
+            const auto saved_capacity(static_cast<std::size_t>(header.capacity));
+            auto complete(true);
+            tools::for_each_type<typename Settings::ComponentList>([&directory, saved_capacity, &complete]<typename TComponent>() {
+                complete = complete && ComponentStorage::template hasFiles<TComponent>(directory, saved_capacity);
+            });
+            if (!complete) return false;
+
+            if (!mapAllColumns(directory, true) || !loadSnapshot(blob)) {
+                clear();
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * Enregistre un observateur notifié (au refresh) de l'ajout d'un composant.
+         *
+         * TFunction est invoquée avec (TContext &, Manager &, EntityIndex) : fonction libre,
+         * lambda sans capture ou fonction membre de TContext. Le contexte doit survivre à
+         * l'enregistrement (voir removeObservers).
+         *
+         *   manager.onAdd<CShape, &GameScene::onShapeAdded>(*this);
+         *
+         * @tparam TComponent Type de composant observé
+         * @tparam TFunction Fonction à invoquer
+         * @tparam TContext Type du contexte
+         * @param context Contexte transmis à la fonction
+         */
+        template<typename TComponent, auto TFunction, typename TContext>
+        auto onAdd(TContext &context) noexcept -> void {
+            static_assert(Settings::template isComponent<TComponent>(), "TComponent must be a Component");
+            observers.template onAdd<TComponent>(&impl::invokeHook<ThisType, TFunction, TContext>, &context);
+        }
+
+        /**
+         * Enregistre un observateur notifié (au refresh) du retrait d'un composant, que ce soit
+         * par delComponent ou par la mort de l'entité. Dans ce dernier cas, le composant est
+         * encore lisible pendant la notification.
+         *
+         * @tparam TComponent Type de composant observé
+         * @tparam TFunction Fonction à invoquer
+         * @tparam TContext Type du contexte
+         * @param context Contexte transmis à la fonction
+         */
+        template<typename TComponent, auto TFunction, typename TContext>
+        auto onRemove(TContext &context) noexcept -> void {
+            static_assert(Settings::template isComponent<TComponent>(), "TComponent must be a Component");
+            observers.template onRemove<TComponent>(&impl::invokeHook<ThisType, TFunction, TContext>, &context);
+        }
+
+        /**
+         * Enregistre un observateur notifié (au refresh) de l'ajout d'un tag
+         *
+         * @tparam TTag Type de tag observé
+         * @tparam TFunction Fonction à invoquer
+         * @tparam TContext Type du contexte
+         * @param context Contexte transmis à la fonction
+         */
+        template<typename TTag, auto TFunction, typename TContext>
+        auto onTagAdded(TContext &context) noexcept -> void {
+            static_assert(Settings::template isTag<TTag>(), "TTag must be a Tag");
+            observers.template onTagAdded<TTag>(&impl::invokeHook<ThisType, TFunction, TContext>, &context);
+        }
+
+        /**
+         * Enregistre un observateur notifié (au refresh) de la mort d'une entité.
+         * Les composants et tags de l'entité sont encore lisibles pendant la notification.
+         *
+         * @tparam TFunction Fonction à invoquer
+         * @tparam TContext Type du contexte
+         * @param context Contexte transmis à la fonction
+         */
+        template<auto TFunction, typename TContext>
+        auto onKilled(TContext &context) noexcept -> void {
+            observers.onKilled(&impl::invokeHook<ThisType, TFunction, TContext>, &context);
+        }
+
+        /**
+         * Retire tous les observateurs enregistrés avec ce contexte
+         * @param context Contexte des observateurs à retirer
+         */
+        template<typename TContext>
+        auto removeObservers(const TContext &context) noexcept -> void {
+            observers.remove(&context);
+        }
+
+        /**
+         * Fonction permettant de déterminer si une entité correspond à une signature.
+         *
+         * La fonction applique un et binaire entre le bitset de l'entité et le bitset
+         * de la signature. Une entité désactivée (voir setEnabled) ne correspond à aucune signature.
+         *
+         * @tparam TSignature Signature à utiliser pour la vérification
+         * @param entity_index Index de l'entité à contrôler
+         * @return True si l'entité colle avec la signature
+         */
+        template<typename TSignature>
+        [[nodiscard]] auto matchesSignature(const EntityIndex entity_index) const noexcept -> bool {
+            static_assert(Settings::template isSignature<TSignature>(), "TSignature must be a Signature");
+
+            return isEnabled(entity_index) && matchesSignatureBits<TSignature>(entity_index);
+        }
+
+        /**
+         * Méthode permettant d'appliquer une fonction sur toutes les entités
+         *
+         * @tparam TF Type de la fonction à appliquer (void mFunction(EntityIndex index))
+         * @param mFunction Fonction à appliquer
+         */
+        template<typename TF>
+        auto forEntities(TF &&mFunction) -> void {
+            for (EntityIndex entity_index{0}; entity_index < size; ++entity_index) {
+                mFunction(entity_index);
+            }
+        }
+
+        /**
+         * Méthode permettant d'itérer sur toutes les entités correspondant à la signature.
+         *
          * @tparam TSignature Signature à utiliser pour filtrer les entités
          * @tparam TF Type de la fonction à invoquer pour chaque entité
          * @param mFunction Référence de la fonction à invoquer pour chaque entité
@@ -420,17 +1243,810 @@ namespace ecs {
         auto forEntitiesMatching(TF &&mFunction) -> void {
             static_assert(Settings::template isSignature<TSignature>(), "TSignature must be a Signature");
 
-            forEntities([this, &mFunction](auto entity_index) {
-                if (this->template matchesSignature<TSignature>(entity_index)) {
+            auto probe(queryProbe<TSignature>());
+
+            // Tag rare : seuls ses porteurs sont examinés. Le parcours par nextFrom reste valide
+            // si la fonction ajoute ou retire des tags
+            if constexpr (tools::size_v<typename Settings::SignatureBitsets::template SignatureTags<TSignature>> > 0) {
+                const auto &tag_set(rarestTagSet<TSignature>());
+                if (tag_set.cardinality() * SparseTagRatio < size) {
+                    for (auto next(tag_set.nextFrom(0)); next && *next < size; next = tag_set.nextFrom(*next + 1)) {
+                        const EntityIndex entity_index{*next};
+                        probe.visit();
+                        if (isEnabled(entity_index) && matchesSignatureBits<TSignature>(entity_index)) {
+                            probe.match();
+                            expandSignatureCall<TSignature>(entity_index, mFunction);
+                        }
+                    }
+                    return;
+                }
+            }
+
+            forEnabledEntities([this, &mFunction, &probe](auto entity_index) {
+                probe.visit();
+                if (this->template matchesSignatureBits<TSignature>(entity_index)) {
+                    probe.match();
+                    this->template expandSignatureCall<TSignature>(entity_index, mFunction);
+                }
+            });
+        }
+
+        /**
+         * Méthode permettant d'itérer sur les entités désactivées (voir setEnabled) correspondant
+         * à la signature, par exemple pour réveiller celles qui redeviennent utiles.
+         *
+         * @tparam TSignature Signature à utiliser pour filtrer les entités
+         * @tparam TF Type de la fonction à invoquer pour chaque entité
+         * @param mFunction Référence de la fonction à invoquer pour chaque entité
+         */
+        template<typename TSignature, typename TF>
+        auto forDisabledMatching(TF &&mFunction) -> void {
+            static_assert(Settings::template isSignature<TSignature>(), "TSignature must be a Signature");
+
+            // Tag rare : seuls ses porteurs sont examinés (voir forEntitiesMatching)
+            if constexpr (tools::size_v<typename Settings::SignatureBitsets::template SignatureTags<TSignature>> > 0) {
+                const auto &tag_set(rarestTagSet<TSignature>());
+                if (tag_set.cardinality() * SparseTagRatio < size) {
+                    for (auto next(tag_set.nextFrom(0)); next && *next < size; next = tag_set.nextFrom(*next + 1)) {
+                        const EntityIndex entity_index{*next};
+                        if (!isEnabled(entity_index) && matchesSignatureBits<TSignature>(entity_index)) {
+                            expandSignatureCall<TSignature>(entity_index, mFunction);
+                        }
+                    }
+                    return;
+                }
+            }
+
+            forDisabledEntities([this, &mFunction](auto entity_index) {
+                if (this->template matchesSignatureBits<TSignature>(entity_index)) {
                     this->template expandSignatureCall<TSignature>(entity_index, mFunction);
                 }
             });
         }
 
+        /**
+         * Méthode permettant d'itérer sur les couples d'entités (a, b) où a correspond à la
+         * signature TSignatureA et b à la signature TSignatureB.
+         *
+         * Le broadphase fournit les couples candidats (tous les couples par défaut) ; il peut
+         * élaguer les couples qui ne peuvent pas interagir (grille, arbre, ...).
+         *
+         * Les entités sont capturées au début de l'appel : les entités créées pendant l'itération
+         * ne sont pas visitées, et un couple n'est émis que si ses deux entités sont toujours
+         * vivantes. Tuer une entité dans la fonction (kill différé) est donc sûr.
+         *
+         * @tparam TSignatureA Signature de la première entité du couple
+         * @tparam TSignatureB Signature de la seconde entité du couple
+         * @tparam TF Type de la fonction (void mFunction(EntityIndex a, CA0&, CA1&, ..., EntityIndex b, CB0&, ...))
+         * @tparam TBroadphase Type du fournisseur de couples candidats
+         * @param mFunction Référence de la fonction à invoquer pour chaque couple
+         * @param broadphase Fournisseur de couples candidats
+         */
+        template<typename TSignatureA, typename TSignatureB, typename TF, typename TBroadphase = BruteForceBroadphase>
+        auto forPairsMatching(TF &&mFunction, TBroadphase &&broadphase = TBroadphase{}) -> void {
+            static_assert(Settings::template isSignature<TSignatureA>(), "TSignatureA must be a Signature");
+            static_assert(Settings::template isSignature<TSignatureB>(), "TSignatureB must be a Signature");
+
+            // On récupère les tampons (un appel imbriqué repartira de tampons vides)
+            auto entities_a(std::move(pairEntitiesA));
+            auto entities_b(std::move(pairEntitiesB));
+            entities_a.clear();
+            entities_b.clear();
+
+            // La durée des couples est comptée dans la signature A
+            auto probe_a(queryProbe<TSignatureA>());
+            {
+                auto probe_b(queryProbe<TSignatureB>());
+                for (EntityIndex entity_index{0}; entity_index < size; ++entity_index) {
+                    if (!isAlive(entity_index)) continue;
+                    probe_a.visit();
+                    probe_b.visit();
+                    if (matchesSignature<TSignatureA>(entity_index)) {
+                        probe_a.match();
+                        entities_a.push_back(entity_index);
+                    }
+                    if (matchesSignature<TSignatureB>(entity_index)) {
+                        probe_b.match();
+                        entities_b.push_back(entity_index);
+                    }
+                }
+            }
+
+            broadphase.forEachCandidate(
+                *this,
+                std::span<const EntityIndex>(entities_a),
+                std::span<const EntityIndex>(entities_b),
+                [this, &mFunction](const EntityIndex entity_a, const EntityIndex entity_b) {
+                    if (entity_a == entity_b) return;
+                    if (!isAlive(entity_a) || !isAlive(entity_b)) return;
+
+                    this->template expandSignatureCall<TSignatureA>(
+                        entity_a, [this, &mFunction, entity_b](const EntityIndex index_a, auto &... components_a) {
+                            this->template expandSignatureCall<TSignatureB>(
+                                entity_b, [&mFunction, index_a, &components_a...](const EntityIndex index_b,
+                                                                                 auto &... components_b) {
+                                    mFunction(index_a, components_a..., index_b, components_b...);
+                                });
+                        });
+                });
+
+            pairEntitiesA = std::move(entities_a);
+            pairEntitiesB = std::move(entities_b);
+        }
+
+        /**
+         * Retourne une vue (forward_range) sur les entités correspondant à la signature.
+         *
+         * Chaque élément est un std::tuple<EntityIndex, C0&, C1&, ...> avec les composants de
+         * la signature (sans les tags), dans l'ordre de la signature.
+         * La vue est invalidée par refresh() et par toute création d'entité.
+         *
+         * @tparam TSignature Signature à utiliser pour filtrer les entités
+         * @return Vue sur les entités correspondantes
+         */
+        template<typename TSignature>
+        [[nodiscard]] auto view() noexcept {
+            static_assert(Settings::template isSignature<TSignature>(), "TSignature must be a Signature");
+
+            using RequiredComponents = typename Settings::SignatureBitsets::template SignatureComponents<TSignature>;
+
+            return impl::View<ThisType, TSignature, RequiredComponents>{*this, size};
+        }
+
+        /**
+         * Méthode permettant d'itérer par blocs contigus sur les entités correspondant à la signature.
+         *
+         * Un bloc est une suite d'entités consécutives correspondant à la signature dont les
+         * composants sont eux aussi consécutifs dans leurs colonnes. La fonction reçoit l'index
+         * de la première entité du bloc puis un std::span par composant de la signature (sans
+         * les tags), dans l'ordre de la signature : l'élément i des spans correspond à l'entité
+         * (first + i). Les kernels peuvent ainsi être écrits sous forme de boucles vectorisables.
+         *
+         * Seul le début de chaque colonne est aligné sur tools::ColumnAlignment octets : un bloc
+         * commence à l'offset k de ses colonnes et n'est aligné que si k * sizeof(Composant) est
+         * un multiple de tools::ColumnAlignment. Les kernels ne doivent donc pas supposer des
+         * spans alignés (chargements non alignés, ou traitement à part des premiers éléments).
+         *
+         * Les composants partagés (ecs::Shared<T>) sont fournis sous forme d'index : la valeur
+         * s'obtient avec getShared.
+         *
+         * ATTENTION : la fonction ne doit pas créer d'entités (une croissance du stockage
+         * invaliderait les spans en cours).
+         *
+         * @tparam TSignature Signature à utiliser pour filtrer les entités
+         * @tparam TF Type de la fonction (void mFunction(EntityIndex first, std::span<C0>, std::span<C1>, ...))
+         * @param mFunction Référence de la fonction à invoquer pour chaque bloc
+         */
+        template<typename TSignature, typename TF>
+        auto forChunksMatching(TF &&mFunction) -> void {
+            static_assert(Settings::template isSignature<TSignature>(), "TSignature must be a Signature");
+
+            auto probe(queryProbe<TSignature>());
+            EntityIndex entity_index{0};
+            while (entity_index < size) {
+                probe.visit();
+                if (!matchesSignature<TSignature>(entity_index)) {
+                    ++entity_index;
+                    continue;
+                }
+
+                probe.match();
+                const EntityIndex first(entity_index);
+                const DataIndex first_data(getEntity(first).dataIndex);
+                std::size_t count{1};
+
+                for (++entity_index; entity_index < size; ++entity_index) {
+                    // Une entité qui interrompt le bloc est comptée par la boucle externe
+                    if (!matchesSignature<TSignature>(entity_index)) break;
+                    if (getEntity(entity_index).dataIndex.get() != first_data.get() + count) break;
+                    probe.visit();
+                    probe.match();
+                    ++count;
+                }
+
+                expandChunkCall<TSignature>(first, first_data, count, mFunction);
+            }
+        }
+
+        /**
+         * Tue en une passe les entités correspondant à la signature qui satisfont un prédicat
+         * (durée de vie écoulée, sortie de l'écran, fin de vague, ...).
+         *
+         * Le prédicat reçoit les composants de la signature (sans les tags), dans l'ordre de la
+         * signature, et ne doit pas modifier le Manager. Pour un groupe possédant (voir
+         * forGroup), il est évalué sur le début des colonnes dans un masque, boucle que le
+         * compilateur peut vectoriser si le prédicat est simple, puis les entités marquées sont
+         * tuées. Pour une autre signature, test de signature, prédicat et mort sont faits dans
+         * le même parcours des entités actives. Comme pour kill, les entités restent visibles
+         * des requêtes jusqu'au prochain refresh ; les entités déjà tuées ou désactivées ne sont
+         * ni tuées ni comptées.
+         *
+         * @tparam TSignature Signature à utiliser pour filtrer les entités
+         * @tparam TF Type du prédicat (bool predicate(const C0 &, const C1 &, ...))
+         * @param predicate Prédicat : true si l'entité doit être tuée
+         * @return Nombre d'entités tuées
+         */
+        template<typename TSignature, typename TF>
+        auto killIf(TF &&predicate) -> std::size_t {
+            static_assert(Settings::template isSignature<TSignature>(), "TSignature must be a Signature");
+
+            using RequiredComponents = typename Settings::SignatureBitsets::template SignatureComponents<TSignature>;
+            using Helper = tools::rename_t<KillIfHelper, RequiredComponents>;
+
+            auto probe(queryProbe<TSignature>());
+            if constexpr (Settings::template isGroup<TSignature>()) {
+                const auto count(groupSize<TSignature>());
+                probe.visit(count);
+                probe.match(count);
+                return Helper::killGroup(count, *this, predicate);
+            } else {
+                std::size_t killed{0};
+                forEnabledEntities([this, &predicate, &killed, &probe](const EntityIndex entity_index) {
+                    probe.visit();
+                    if (!this->template matchesSignatureBits<TSignature>(entity_index)) return;
+
+                    probe.match();
+                    if (!isAlive(entity_index)) return;
+                    if (!Helper::test(getEntity(entity_index).dataIndex, *this, predicate)) return;
+                    kill(entity_index);
+                    ++killed;
+                });
+                return killed;
+            }
+        }
+
+        /**
+         * Méthode permettant d'itérer sur les membres d'un groupe possédant (voir
+         * Settings::GroupList) : leurs composants occupent le début de chaque colonne, dans le
+         * même ordre. Le parcours est une simple marche parallèle sur les colonnes, sans
+         * indirection ni test de signature.
+         *
+         * La composition des groupes est mise à jour au refresh (comme la mort des entités) :
+         * une entité ayant gagné les composants du groupe, ou ayant été réactivée, n'y entre
+         * qu'au refresh suivant ; une entité tuée, désactivée ou ayant perdu un composant du
+         * groupe est visitée jusqu'au refresh. Le refresh déplace les composants des entités
+         * reclassées : les références obtenues avant un refresh ne doivent pas être conservées.
+         *
+         * ATTENTION : la fonction ne doit pas créer d'entités (une croissance du stockage
+         * invaliderait les colonnes en cours de parcours).
+         *
+         * @tparam TSignature Signature du groupe
+         * @tparam TF Type de la fonction (void mFunction(EntityIndex index, C0&, C1&, ...))
+         * @param mFunction Référence de la fonction à invoquer pour chaque membre
+         */
+        template<typename TSignature, typename TF>
+        auto forGroup(TF &&mFunction) -> void {
+            static_assert(Settings::template isGroup<TSignature>(), "TSignature must be a Group");
+
+            using RequiredComponents = typename Settings::SignatureBitsets::template SignatureComponents<TSignature>;
+            using Helper = tools::rename_t<ExpandGroupCallHelper, RequiredComponents>;
+
+            const auto count(groupSize<TSignature>());
+            auto probe(queryProbe<TSignature>());
+            probe.visit(count);
+            probe.match(count);
+
+            Helper::call(count, *this, mFunction);
+        }
+
+        /**
+         * Nombre de membres d'un groupe possédant (composition au dernier refresh)
+         *
+         * @tparam TSignature Signature du groupe
+         * @return Nombre d'entités du groupe
+         */
+        template<typename TSignature>
+        [[nodiscard]] auto groupSize() const noexcept -> std::size_t {
+            static_assert(Settings::template isGroup<TSignature>(), "TSignature must be a Group");
+            return groupSizes[static_cast<std::size_t>(Settings::template groupID<TSignature>())];
+        }
+
+        /**
+         * Méthode permettant d'itérer sur les entités correspondant à la signature dont les
+         * composants ont été ajoutés ou modifiés depuis le dernier passage.
+         *
+         * Les filtres sont des ecs::Changed<T> ou ecs::Added<T> ; tous doivent être satisfaits.
+         * last_run est le tick du dernier passage de l'appelant : il est mis à jour à la fin de
+         * l'itération. Les modifications faites pendant l'itération ne seront pas revues au
+         * passage suivant.
+         *
+         * @tparam TSignature Signature à utiliser pour filtrer les entités
+         * @tparam TFilter Premier filtre (ecs::Changed<T> ou ecs::Added<T>)
+         * @tparam TFilters Filtres supplémentaires
+         * @tparam TF Type de la fonction à invoquer pour chaque entité
+         * @param last_run Tick du dernier passage (initialement ChangeTick{0u} pour tout voir)
+         * @param mFunction Référence de la fonction à invoquer pour chaque entité
+         */
+        template<typename TSignature, typename TFilter, typename... TFilters, typename TF>
+        auto forEntitiesMatching(ChangeTick &last_run, TF &&mFunction) -> void {
+            static_assert(Settings::template isSignature<TSignature>(), "TSignature must be a Signature");
+
+            const ChangeTick since(last_run);
+
+            auto probe(queryProbe<TSignature>());
+            forEnabledEntities([this, &mFunction, since, &probe](auto entity_index) {
+                probe.visit();
+                if (!this->template matchesSignatureBits<TSignature>(entity_index)) return;
+                if (!this->template passesChangeFilter<TFilter>(entity_index, since)) return;
+                if (!(this->template passesChangeFilter<TFilters>(entity_index, since) && ...)) return;
+
+                probe.match();
+                this->template expandSignatureCall<TSignature>(entity_index, mFunction);
+            });
+
+            updateChangeTick(last_run);
+        }
+
+        /**
+         * Méthode permettant d'itérer sur les entités correspondant à la signature dans la limite
+         * d'un budget de temps : l'itération s'arrête dès que le budget est dépassé et reprend au
+         * même endroit à l'appel suivant (typiquement à la frame suivante). Destinée aux
+         * traitements de maintenance qui n'ont pas besoin d'être terminés en une frame.
+         *
+         * Le budget n'est contrôlé que toutes les SliceCheckInterval entités traitées (au moins
+         * une est toujours traitée). Le curseur n'est pas ajusté par refresh : une passe qui
+         * s'étend sur plusieurs refresh est approximative, les entités que le compactage déplace
+         * avant le curseur n'étant vues qu'à la passe suivante (voir QueryCursor).
+         *
+         * @tparam TSignature Signature à utiliser pour filtrer les entités
+         * @tparam TF Type de la fonction à invoquer pour chaque entité
+         * @param cursor Position de reprise, conservée par l'appelant entre deux appels
+         * @param budget Durée maximale de l'appel (traitement des entités compris)
+         * @param mFunction Référence de la fonction à invoquer pour chaque entité
+         * @return true si la passe est terminée (le curseur repart alors de la première entité)
+         */
+        template<typename TSignature, typename TF>
+        auto forEntitiesMatching(QueryCursor &cursor, const std::chrono::microseconds budget,
+                                 TF &&mFunction) -> bool {
+            static_assert(Settings::template isSignature<TSignature>(), "TSignature must be a Signature");
+
+            const auto deadline(std::chrono::steady_clock::now() + budget);
+            std::size_t processed{0};
+
+            auto probe(queryProbe<TSignature>());
+            const auto stop(forEnabledEntitiesFrom(cursor.next.get(),
+                [this, &mFunction, &probe, &processed, deadline](auto entity_index) {
+                    probe.visit();
+                    if (!this->template matchesSignatureBits<TSignature>(entity_index)) return true;
+
+                    probe.match();
+                    this->template expandSignatureCall<TSignature>(entity_index, mFunction);
+                    return ++processed % SliceCheckInterval != 0 || std::chrono::steady_clock::now() < deadline;
+                }));
+
+            if (stop < size) {
+                cursor.next = EntityIndex{stop + 1};
+                return false;
+            }
+
+            cursor.next = EntityIndex{0};
+            ++cursor.passes;
+            return true;
+        }
+
+        /**
+         * Nombre d'entités traitées entre deux contrôles du budget d'une requête découpée
+         */
+        static constexpr std::size_t SliceCheckInterval{8};
+
     private:
+        template<typename TSignature>
+        [[nodiscard]] auto queryProbe() noexcept -> impl::QueryProbe {
+            return queryRecorder.probe(static_cast<std::size_t>(Settings::template signatureID<TSignature>()));
+        }
+
+        /**
+         * Signale un changement de composition d'une entité : elle sera reclassée dans les
+         * groupes au prochain refresh. Seuls les types présents dans un groupe sont suivis.
+         *
+         * @tparam TChanged Composant ou tag modifié (void : état de l'entité, activation, mort)
+         */
+        template<typename TChanged = void>
+        auto groupChanged(const EntityIndex entity_index) -> void {
+            if constexpr (GroupCount > 0) {
+                // Le groupe le plus restrictif contient les types de tous les autres
+                using NarrowestGroup = tools::at_t<GroupCount - 1, typename Settings::GroupList>;
+                if constexpr (std::is_void_v<TChanged> || tools::contains_v<TChanged, NarrowestGroup>) {
+                    // Les créateurs concurrents ne touchent pas aux groupes (voir endConcurrentCreation)
+                    if (!concurrentCreation) pendingGroupUpdates.push_back(entity_index);
+                }
+            }
+        }
+
+        /**
+         * Reclasse une entité : sorties du groupe le plus restrictif au plus large, puis entrées
+         * du plus large au plus restrictif. Chaque mouvement échange deux emplacements de données.
+         */
+        auto updateGroups(const EntityIndex entity_index) noexcept -> void {
+            [this, entity_index]<std::size_t... TGroups>(std::index_sequence<TGroups...>) {
+                (leaveGroup<GroupCount - 1 - TGroups>(entity_index), ...);
+                (enterGroup<TGroups>(entity_index), ...);
+            }(std::make_index_sequence<GroupCount>{});
+        }
+
+        template<std::size_t TGroup>
+        [[nodiscard]] auto isGroupCandidate(const EntityIndex entity_index) const noexcept -> bool {
+            using Group = tools::at_t<TGroup, typename Settings::GroupList>;
+            return getEntity(entity_index).alive && isEnabled(entity_index) &&
+                   matchesSignatureBits<Group>(entity_index);
+        }
+
+        template<std::size_t TGroup>
+        auto leaveGroup(const EntityIndex entity_index) noexcept -> void {
+            const auto data_index(getEntity(entity_index).dataIndex);
+            if (data_index.get() >= groupSizes[TGroup] || isGroupCandidate<TGroup>(entity_index)) return;
+
+            // Le dernier membre prend la place de l'entité sortante
+            swapData(data_index, DataIndex{--groupSizes[TGroup]});
+        }
+
+        template<std::size_t TGroup>
+        auto enterGroup(const EntityIndex entity_index) noexcept -> void {
+            const auto data_index(getEntity(entity_index).dataIndex);
+            if (data_index.get() < groupSizes[TGroup] || !isGroupCandidate<TGroup>(entity_index)) return;
+
+            swapData(data_index, DataIndex{groupSizes[TGroup]++});
+        }
+
+        /**
+         * Échange deux emplacements de données (composants et horodatages) et leurs entités
+         */
+        auto swapData(const DataIndex a, const DataIndex b) noexcept -> void {
+            if (a.get() == b.get()) return;
+
+            const auto owner_a(dataOwners[a.get()]);
+            const auto owner_b(dataOwners[b.get()]);
+
+            components.swap(a, b);
+            entities[owner_a].dataIndex = b;
+            entities[owner_b].dataIndex = a;
+            dataOwners[a.get()] = owner_b;
+            dataOwners[b.get()] = owner_a;
+        }
+
+        /**
+         * Reconstruit les groupes (après le chargement d'un snapshot)
+         */
+        auto rebuildGroups() noexcept -> void {
+            if constexpr (GroupCount > 0) {
+                groupSizes.fill(0);
+                pendingGroupUpdates.clear();
+                for (EntityIndex entity_index{0}; entity_index < capacity; ++entity_index) {
+                    dataOwners[entities[entity_index].dataIndex.get()] = entity_index;
+                }
+                for (EntityIndex entity_index{0}; entity_index < sizeNext; ++entity_index) {
+                    updateGroups(entity_index);
+                }
+            }
+        }
+
+        auto setEnabledBit(const EntityIndex entity_index, const bool enabled) noexcept -> void {
+            auto &word(enabledBits[entity_index.get() / EnabledWordBits]);
+            const auto mask(std::uint64_t{1} << (entity_index.get() % EnabledWordBits));
+            word = enabled ? word | mask : word & ~mask;
+        }
+
+        /**
+         * Comparaison du bitset de l'entité avec celui de la signature, sans tenir compte de
+         * l'activation de l'entité
+         */
+        template<typename TSignature>
+        [[nodiscard]] auto matchesSignatureBits(const EntityIndex entity_index) const noexcept -> bool {
+            const auto &entityBitset(getEntity(entity_index).bitset);
+            const auto &signatureBitset(signatureBitsets.template getSignatureBitset<TSignature>());
+
+            return (signatureBitset & entityBitset) == signatureBitset;
+        }
+
+        /**
+         * Applique une fonction sur les entités actives, mot par mot : 64 entités désactivées
+         * consécutives ne coûtent qu'un test.
+         *
+         * @tparam TF Type de la fonction à appliquer (void mFunction(EntityIndex index))
+         * @param mFunction Fonction à appliquer
+         */
+        template<typename TF>
+        auto forEnabledEntities(TF &&mFunction) -> void {
+            for (std::size_t word_index{0}; word_index * EnabledWordBits < size; ++word_index) {
+                auto word(enabledBits[word_index]);
+
+                const auto remaining(size - word_index * EnabledWordBits);
+                if (remaining < EnabledWordBits) word &= (std::uint64_t{1} << remaining) - 1;
+
+                while (word != 0) {
+                    const auto bit(static_cast<std::size_t>(std::countr_zero(word)));
+                    word &= word - 1;
+                    mFunction(EntityIndex{word_index * EnabledWordBits + bit});
+                }
+            }
+        }
+
+        /**
+         * Pendant de forEnabledEntities pour les entités désactivées (mots inversés) : 64 entités
+         * actives consécutives ne coûtent qu'un test.
+         *
+         * @tparam TF Type de la fonction à appliquer (void mFunction(EntityIndex index))
+         * @param mFunction Fonction à appliquer
+         */
+        template<typename TF>
+        auto forDisabledEntities(TF &&mFunction) -> void {
+            for (std::size_t word_index{0}; word_index * EnabledWordBits < size; ++word_index) {
+                auto word(~enabledBits[word_index]);
+
+                const auto remaining(size - word_index * EnabledWordBits);
+                if (remaining < EnabledWordBits) word &= (std::uint64_t{1} << remaining) - 1;
+
+                while (word != 0) {
+                    const auto bit(static_cast<std::size_t>(std::countr_zero(word)));
+                    word &= word - 1;
+                    mFunction(EntityIndex{word_index * EnabledWordBits + bit});
+                }
+            }
+        }
+
+        /**
+         * Variante interruptible de forEnabledEntities : commence à l'entité first et s'arrête dès
+         * que la fonction retourne false.
+         *
+         * @tparam TF Type de la fonction à appliquer (bool mFunction(EntityIndex index))
+         * @param first Première entité examinée
+         * @param mFunction Fonction à appliquer, false pour interrompre l'itération
+         * @return Index de l'entité ayant interrompu l'itération, ou size si elle est terminée
+         */
+        template<typename TF>
+        auto forEnabledEntitiesFrom(const std::size_t first, TF &&mFunction) -> std::size_t {
+            for (std::size_t word_index{first / EnabledWordBits}; word_index * EnabledWordBits < size; ++word_index) {
+                auto word(enabledBits[word_index]);
+
+                const auto remaining(size - word_index * EnabledWordBits);
+                if (remaining < EnabledWordBits) word &= (std::uint64_t{1} << remaining) - 1;
+                if (word_index == first / EnabledWordBits) word &= ~std::uint64_t{0} << (first % EnabledWordBits);
+
+                while (word != 0) {
+                    const auto bit(static_cast<std::size_t>(std::countr_zero(word)));
+                    word &= word - 1;
+
+                    const auto entity_index(word_index * EnabledWordBits + bit);
+                    if (!mFunction(EntityIndex{entity_index})) return entity_index;
+                }
+            }
+            return size;
+        }
+
+        /**
+         * Écrit l'image du Manager (voir saveSnapshot)
+         *
+         * @param blob Tampon de destination
+         * @param external true pour omettre les colonnes projetées (SnapshotExternalColumns)
+         */
+        auto writeSnapshot(std::vector<std::byte> &blob, const bool external) const -> void {
+            SnapshotWriter writer(blob);
+
+            writer.write(SnapshotHeader{
+                SnapshotMagic, SnapshotVersion, snapshotLayout(), capacity, size, sizeNext, changeTick.get(),
+                external ? SnapshotExternalColumns : 0u
+            });
+
+            writer.align();
+            writer.writeBytes(entities.data(), capacity * sizeof(Entity));
+            writer.writeBytes(handleData.data(), capacity * sizeof(HandleData));
+            writer.writeBytes(enabledBits.data(), enabledBits.size() * sizeof(std::uint64_t));
+
+            tools::for_each_type<typename Settings::ComponentList>([this, &writer, external]<typename TComponent>() {
+                writer.align();
+                if constexpr (BulkSnapshotable<TComponent>) {
+                    if (!external) {
+                        writer.writeBytes(components.template data<TComponent>(), capacity * sizeof(TComponent));
+                    }
+                } else {
+                    for (EntityIndex entity_index{0}; entity_index < sizeNext; ++entity_index) {
+                        if (!hasComponent<TComponent>(entity_index)) continue;
+                        SnapshotCodec<TComponent>::write(
+                            writer, components.template getComponent<TComponent>(getEntity(entity_index).dataIndex));
+                    }
+                }
+                if (!external) {
+                    writer.writeBytes(components.template ticksData<TComponent>(), capacity * sizeof(impl::ComponentTicks));
+                }
+            });
+
+            tools::for_each_type<typename Settings::ResourceList>([this, &writer]<typename TResource>() {
+                if constexpr (BulkSnapshotable<TResource>) {
+                    writer.write(resource<TResource>());
+                } else {
+                    SnapshotCodec<TResource>::write(writer, resource<TResource>());
+                }
+            });
+
+            sharedPools.save(writer);
+        }
+
+        /**
+         * Projette les colonnes de tous les composants (voir mapColumns et openMapped)
+         *
+         * @param directory Répertoire des fichiers de colonnes
+         * @param keep_content true pour relire le contenu des fichiers
+         */
+        auto mapAllColumns(const std::filesystem::path &directory, const bool keep_content) -> bool {
+            if constexpr (!tools::MappedFile::Supported) return false;
+
+            std::error_code error;
+            std::filesystem::create_directories(directory, error);
+            if (error) return false;
+
+            auto mapped(true);
+            tools::for_each_type<typename Settings::ComponentList>([this, &directory, keep_content, &mapped]<typename TComponent>() {
+                mapped = mapped && components.template map<TComponent>(directory, keep_content);
+            });
+            if (mapped) mappedDirectory = directory;
+            return mapped;
+        }
+
+        /**
+         * Vérifie qu'un en-tête de snapshot correspond à ce Manager (format, Settings, tailles)
+         *
+         * @param header En-tête lu
+         * @param blob_size Taille de l'image
+         */
+        [[nodiscard]] static auto isValidHeader(const SnapshotHeader &header, const std::size_t blob_size) noexcept -> bool {
+            return header.magic == SnapshotMagic &&
+                   header.version == SnapshotVersion &&
+                   header.layout == snapshotLayout() &&
+                   (header.flags & ~SnapshotExternalColumns) == 0 &&
+                   header.capacity <= blob_size &&
+                   header.sizeNext <= header.capacity &&
+                   header.size <= header.sizeNext;
+        }
+
+        /**
+         * Empreinte de la structure des Settings, vérifiée au chargement d'un snapshot
+         */
+        static constexpr auto snapshotLayout() noexcept -> std::uint64_t {
+            static_assert(std::is_trivially_copyable_v<Entity> && std::is_trivially_copyable_v<HandleData>);
+
+            auto layout(impl::snapshotLayoutOf<Entity>(14695981039346656037ull));
+            layout = impl::snapshotLayoutOfAll(layout, typename Settings::ComponentList{});
+            layout = impl::snapshotLayoutOfAll(layout, typename Settings::TagList{});
+            layout = impl::snapshotLayoutOfAll(layout, typename Settings::ResourceList{});
+            return impl::snapshotLayoutOfAll(layout, typename SharedPools::Values{});
+        }
+
+        /**
+         * Vérifie si une entité satisfait un filtre de changement
+         *
+         * @tparam TFilter Filtre (ecs::Changed<T> ou ecs::Added<T>)
+         * @param entity_index Index de l'entité
+         * @param since Tick de référence
+         * @return true si le composant est présent et horodaté après since
+         */
+        template<typename TFilter>
+        [[nodiscard]] auto passesChangeFilter(const EntityIndex entity_index, const ChangeTick since) const noexcept
+            -> bool {
+            using Filter = impl::ChangeFilter<TFilter>;
+            using Component = typename Filter::Component;
+            static_assert(Settings::template isComponent<Component>(), "Filtered type must be a Component");
+
+            if (!hasComponent<Component>(entity_index)) return false;
+
+            return Filter::passes(components.template getTicks<Component>(getEntity(entity_index).dataIndex), since);
+        }
+
+        /**
+         * Valeur fournie par les requêtes pour un composant : le composant lui-même, ou la valeur
+         * partagée (constante) pour un ecs::Shared<T>
+         */
+        template<typename TComponent>
+        [[nodiscard]] auto queryValue(TComponent &component) const noexcept -> impl::QueryArgument_t<TComponent> {
+            if constexpr (impl::IsShared<TComponent>::value) {
+                return sharedPools.template get<typename TComponent::Type>().get(component.index);
+            } else {
+                return component;
+            }
+        }
+
         template<typename... TSignature>
         struct ExpandCallHelper;
 
+        template<typename... TSignature>
+        struct ExpandChunkCallHelper;
+
+        template<typename... TSignature>
+        struct ExpandGroupCallHelper;
+
+        template<typename... TSignature>
+        struct KillIfHelper;
+
+        /**
+         * Permet d'appeler une fonction pour un bloc d'entités en fonction de la signature attendue.
+         *
+         * @tparam TSignature Signature à utiliser
+         * @tparam TF Type de la fonction à appeler
+         * @param first Index de la première entité du bloc
+         * @param first_data Index des composants de la première entité du bloc
+         * @param count Nombre d'entités dans le bloc
+         * @param mFunction Référence vers la fonction à appeler
+         */
+        template<typename TSignature, typename TF>
+        auto expandChunkCall(const EntityIndex first, const DataIndex first_data, const std::size_t count,
+                             TF &&mFunction) -> void {
+            using RequiredComponents = typename Settings::SignatureBitsets::template SignatureComponents<TSignature>;
+            using Helper = tools::rename_t<ExpandChunkCallHelper, RequiredComponents>;
+
+            Helper::call(first, first_data, count, *this, mFunction);
+        }
+
+        /**
+         * Permet d'appeler la fonction avec un std::span par Component composant la signature
+         * attendue (sans les tags)
+         *
+         * @tparam TSignature Signature à utiliser pour les paramètres de la fonction
+         */
+        template<typename... TSignature>
+        struct ExpandChunkCallHelper {
+            template<typename TF>
+            static void call(const EntityIndex first, const DataIndex first_data,
+                             [[maybe_unused]] const std::size_t count, ThisType &manager, TF &&mFunction) {
+                mFunction(first, std::span<TSignature>(manager.components.template data<TSignature>() + first_data.get(),
+                                                       count)...);
+            }
+        };
+
+        /**
+         * Évaluation du prédicat de killIf avec les composants de la signature (sans les tags)
+         *
+         * @tparam TSignature Composants de la signature
+         */
+        template<typename... TSignature>
+        struct KillIfHelper {
+            template<typename TF>
+            static auto test(const DataIndex data_index, ThisType &manager, TF &&predicate) -> bool {
+                return predicate(std::as_const(manager.queryValue(
+                    manager.components.template getComponent<TSignature>(data_index)))...);
+            }
+
+            template<typename TF>
+            static auto killGroup(const std::size_t count, ThisType &manager, TF &&predicate) -> std::size_t {
+                if (manager.killMask.size() < count) manager.killMask.resize(count);
+
+                // Évaluation sur les colonnes, sans indirection ni branchement
+                [count, &manager, &predicate](std::uint8_t *mask, TSignature *... columns) {
+                    for (std::size_t i{0}; i < count; ++i) {
+                        mask[i] = predicate(std::as_const(manager.queryValue(columns[i]))...) ? 1 : 0;
+                    }
+                }(manager.killMask.data(), manager.components.template data<TSignature>()...);
+
+                // Les membres tués ou désactivés depuis le dernier refresh sont encore dans le groupe
+                std::size_t killed{0};
+                for (std::size_t i{0}; i < count; ++i) {
+                    if (!manager.killMask[i]) continue;
+
+                    const auto owner(manager.dataOwners[i]);
+                    if (!manager.isAlive(owner) || !manager.isEnabled(owner)) continue;
+                    manager.kill(owner);
+                    ++killed;
+                }
+                return killed;
+            }
+        };
+
+        /**
+         * Permet d'appeler la fonction pour chaque membre d'un groupe : les colonnes des composants
+         * (sans les tags) sont parcourues en parallèle
+         *
+         * @tparam TSignature Composants de la signature du groupe
+         */
+        template<typename... TSignature>
+        struct ExpandGroupCallHelper {
+            template<typename TF>
+            static void call(const std::size_t count, ThisType &manager, TF &&mFunction) {
+                [count, &manager, &mFunction](const EntityIndex *owners, TSignature *... columns) {
+                    for (std::size_t i{0}; i < count; ++i) {
+                        mFunction(owners[i], manager.queryValue(columns[i])...);
+                    }
+                }(manager.dataOwners.data(), manager.components.template data<TSignature>()...);
+            }
+        };
+
         /**
          * Permet d'appeler une fonction pour une entité donnée en fonction de la signature attendue.
          *
@@ -471,7 +2087,7 @@ namespace ecs {
             static void call(const EntityIndex entity_index, ThisType &manager, TF &&mFunction) {
                 auto &data_index(manager.getEntity(entity_index).dataIndex);
 
-                mFunction(entity_index, manager.components.template getComponent<TSignature>(data_index)...);
+                mFunction(entity_index, manager.queryValue(manager.components.template getComponent<TSignature>(data_index))...);
             }
         };
 
@@ -497,6 +2113,80 @@ namespace ecs {
             hd.entityIndex = entity_index;
         }
 
+        /**
+         * Libère les valeurs partagées d'une entité morte. Les bits sont effacés : une entité
+         * visitée deux fois par refreshImpl n'est libérée qu'une fois.
+         */
+        auto releaseShared(const EntityIndex entity_index) noexcept -> void {
+            if constexpr (HasShared) {
+                auto &entity(entities[entity_index]);
+                tools::for_each_type<SharedList>([this, &entity]<typename TShared>() {
+                    auto &&bit(entity.bitset[Settings::template componentBit<TShared>()]);
+                    if (!bit) return;
+
+                    bit = false;
+                    sharedPools.template get<typename TShared::Type>().release(
+                        components.template getComponent<TShared>(entity.dataIndex).index);
+                });
+            }
+        }
+
+        template<typename TTag>
+        static constexpr auto tagIndex() noexcept -> std::size_t {
+            return static_cast<std::size_t>(Settings::template tagID<TTag>());
+        }
+
+        /**
+         * L'entité vivante from remplace l'entité morte to (refreshImpl) : l'index to porte
+         * désormais les tags de from. Les index libérés en fin de tableau sont retirés en une
+         * fois à la fin du refresh (RoaringBitmap::removeFrom).
+         */
+        auto moveTags(const EntityIndex from, const EntityIndex to) -> void {
+            const auto &moved(entities[from].bitset);
+            const auto &replaced(entities[to].bitset);
+            if (((moved | replaced) & TagBits).none()) return;
+
+            for (std::size_t tag{0}; tag < TagCount; ++tag) {
+                const auto bit(static_cast<std::size_t>(Settings::componentCount()) + tag);
+                if (moved[bit]) {
+                    tagSets[tag].add(static_cast<std::uint32_t>(to.get()));
+                } else if (replaced[bit]) {
+                    tagSets[tag].remove(static_cast<std::uint32_t>(to.get()));
+                }
+            }
+        }
+
+        /**
+         * Reconstruit les porteurs des tags à partir des bits des entités (après un chargement)
+         */
+        auto rebuildTagSets() -> void {
+            for (auto &tag_set: tagSets) {
+                tag_set.clear();
+            }
+            for (EntityIndex entity_index{0}; entity_index < sizeNext; ++entity_index) {
+                const auto &bitset(entities[entity_index].bitset);
+                for (std::size_t tag{0}; tag < TagCount; ++tag) {
+                    if (bitset[static_cast<std::size_t>(Settings::componentCount()) + tag]) {
+                        tagSets[tag].add(static_cast<std::uint32_t>(entity_index.get()));
+                    }
+                }
+            }
+        }
+
+        /**
+         * Porteurs du tag le moins répandu de la signature
+         */
+        template<typename TSignature>
+        [[nodiscard]] auto rarestTagSet() const noexcept -> const tools::RoaringBitmap & {
+            const tools::RoaringBitmap *rarest{nullptr};
+            tools::for_each_type<typename Settings::SignatureBitsets::template SignatureTags<TSignature>>(
+                [this, &rarest]<typename TTag>() {
+                    const auto &tag_set(tagSets[tagIndex<TTag>()]);
+                    if (rarest == nullptr || tag_set.cardinality() < rarest->cardinality()) rarest = &tag_set;
+                });
+            return *rarest;
+        }
+
         auto refreshImpl() noexcept -> EntityIndex {
             EntityIndex iD{0}, iA{sizeNext - 1};
 
@@ -516,6 +2206,7 @@ namespace ecs {
                     // invalidated. Their handle index doesn't need
                     // to be changed.
                     invalidateHandle(iA);
+                    releaseShared(iA);
 
                     if (iA <= iD) return iD;
                 }
@@ -523,7 +2214,13 @@ namespace ecs {
                 assert(entities[iA].alive);
                 assert(!entities[iD].alive);
 
+                moveTags(iA, iD);
                 std::swap(entities[iA], entities[iD]);
+                setEnabledBit(iD, isEnabled(iA));
+                if constexpr (GroupCount > 0) {
+                    dataOwners[entities[iD].dataIndex.get()] = iD;
+                    dataOwners[entities[iA].dataIndex.get()] = iA;
+                }
 
                 // After swap, the alive entity's handle must be
                 // refreshed, but not invalidated.
@@ -533,6 +2230,7 @@ namespace ecs {
                 // both refreshed and invalidated.
                 invalidateHandle(iA);
                 refreshHandle(iA);
+                releaseShared(iA);
 
                 ++iD;
                 --iA;
@@ -550,6 +2248,83 @@ namespace ecs {
             return capacity;
         }
 
+        /**
+         * Photographie de l'occupation mémoire et de l'état du Manager.
+         *
+         * Un seul parcours des entités vivantes, sans allocation : l'appel peut être fait à
+         * chaque frame (par exemple pour un panneau de debug).
+         *
+         * @return Statistiques du Manager
+         */
+        [[nodiscard]] auto stats() const noexcept -> ManagerStats<Settings> {
+            ManagerStats<Settings> result;
+            result.size = size;
+            result.sizeNext = sizeNext;
+            result.capacity = capacity;
+            result.entityTableBytes = entities.capacity() * sizeof(Entity) +
+                                      enabledBits.capacity() * sizeof(std::uint64_t);
+            result.handleTableBytes = handleData.capacity() * sizeof(HandleData);
+            result.growthCount = growthCount;
+            result.sharedBytes = sharedPools.allocatedBytes();
+            for (const auto &tag_set: tagSets) {
+                result.tagIndexBytes += tag_set.allocatedBytes();
+            }
+
+            tools::for_each_type<typename Settings::ComponentList>([this, &result]<typename TComponent>() {
+                auto &column(result.columns[static_cast<std::size_t>(Settings::template componentID<TComponent>())]);
+                column.name = tools::type_name<TComponent>();
+                column.componentSize = sizeof(TComponent);
+                column.allocatedBytes = capacity * (sizeof(TComponent) + sizeof(impl::ComponentTicks));
+                column.mapped = BulkSnapshotable<TComponent> && components.template isMapped<TComponent>();
+            });
+
+            for (EntityIndex entity_index{0}; entity_index < size; ++entity_index) {
+                const auto &entity(getEntity(entity_index));
+                if (!entity.alive) continue;
+
+                if (entity.dataIndex.get() != entity_index.get()) ++result.outOfOrder;
+                if (!isEnabled(entity_index)) ++result.disabled;
+
+                tools::for_each_type<typename Settings::ComponentList>([&entity, &result]<typename TComponent>() {
+                    if (entity.bitset[Settings::template componentBit<TComponent>()]) {
+                        ++result.columns[static_cast<std::size_t>(Settings::template componentID<TComponent>())].
+                                occupied;
+                    }
+                });
+
+                tools::for_each_type<typename Settings::SignatureList>([this, entity_index, &result]<typename TSignature>() {
+                    if (matchesSignature<TSignature>(entity_index)) {
+                        ++result.signatureMatches[static_cast<std::size_t>(Settings::template signatureID<TSignature>())];
+                    }
+                });
+            }
+
+            return result;
+        }
+
+        /**
+         * Coût des requêtes de chaque signature sur la dernière frame terminée (voir
+         * endQueryFrame), dans l'ordre de la SignatureList.
+         *
+         * Les compteurs ne sont alimentés que si l'instrumentation est compilée
+         * (ECS_QUERY_STATS=1, voir QueryStatsEnabled) ; sinon ils restent nuls et les requêtes
+         * n'ont aucun surcoût. Les vues (view) ne sont pas instrumentées.
+         *
+         * @return Statistiques par signature
+         */
+        [[nodiscard]] auto queryStats() const noexcept
+            -> const std::array<QueryStats, static_cast<std::size_t>(Settings::signatureCount())> & {
+            return queryRecorder.lastFrame();
+        }
+
+        /**
+         * Termine la frame courante : ses statistiques de requêtes deviennent celles retournées
+         * par queryStats() et les compteurs repartent de zéro. À appeler une fois par frame.
+         */
+        auto endQueryFrame() noexcept -> void {
+            queryRecorder.endFrame();
+        }
+
         auto printState(std::ostream &mOSS) const -> std::ostream & {
             mOSS << std::endl
                     << "size: " << size << std::endl
@@ -565,6 +2340,58 @@ namespace ecs {
             return mOSS;
         }
     };
+
+    /**
+     * Déplace une entité d'un monde vers un autre (même paramétrage).
+     *
+     * Les composants sont déplacés (std::move) et les tags recopiés dans une nouvelle entité du
+     * monde destination ; l'entité source est tuée. Pour les observateurs, le déplacement est
+     * donc une création dans destination (onAdd, onTagAdded) et une mort dans source (onRemove,
+     * onKilled), notifiées au prochain refresh de chaque monde. Les observateurs de source
+     * voient alors les composants dans leur état après déplacement (moved-from).
+     *
+     * Le handle source devient invalide au prochain refresh de source : les références vers
+     * l'entité stockées dans d'autres entités (ecs::CHierarchy, ...) doivent être remappées par
+     * l'appelant avec le handle retourné.
+     *
+     * Les deux mondes ne doivent pas être utilisés par d'autres threads pendant le déplacement.
+     *
+     * @tparam TSettings Paramétrage ECS commun aux deux mondes
+     * @param source Monde d'origine
+     * @param handle Entité à déplacer (vivante, dans source)
+     * @param destination Monde destination (différent de source)
+     * @return Handle de l'entité dans destination
+     */
+    template<typename TSettings>
+    auto moveEntity(Manager<TSettings> &source, const Handle &handle, Manager<TSettings> &destination) -> Handle {
+        assert(&source != &destination);
+        assert(source.isAlive(handle));
+
+        const auto source_index(source.getEntityIndex(handle));
+        const auto moved(destination.createHandle());
+        const auto moved_index(destination.getEntityIndex(moved));
+
+        tools::for_each_type<typename TSettings::ComponentList>([&]<typename TComponent>() {
+            if (!source.template hasComponent<TComponent>(source_index)) return;
+
+            // Une valeur partagée est référencée (ou recopiée) dans la table de destination
+            if constexpr (impl::IsShared<TComponent>::value) {
+                using Value = typename TComponent::Type;
+                destination.template setShared<Value>(moved_index, source.template getShared<Value>(source_index));
+            } else {
+                destination.template addComponent<TComponent>(
+                    moved_index, std::move(source.template getComponent<TComponent>(source_index)));
+            }
+        });
+
+        tools::for_each_type<typename TSettings::TagList>([&]<typename TTag>() {
+            if (source.template hasTag<TTag>(source_index)) destination.template addTag<TTag>(moved_index);
+        });
+        destination.setEnabled(moved_index, source.isEnabled(source_index));
+
+        source.kill(source_index);
+        return moved;
+    }
 }
 
 #endif //ECS_MANAGER_H
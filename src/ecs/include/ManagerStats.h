@@ -0,0 +1,114 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_MANAGER_STATS_H
+#define ECS_MANAGER_STATS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ecs {
+
+    /**
+     * Occupation mémoire d'une colonne de composants
+     */
+    struct ColumnStats {
+        // Nom du type de composant (affichage uniquement)
+        std::string_view name;
+        // Taille d'un composant (octets)
+        std::size_t componentSize{0};
+        // Octets alloués : composants et horodatages, pour toute la capacité
+        std::size_t allocatedBytes{0};
+        // Colonne projetée depuis un fichier (voir Manager::mapColumns) : allocatedBytes est
+        // alors paginé à la demande par le système
+        bool mapped{false};
+        // Nombre d'entités vivantes possédant le composant
+        std::size_t occupied{0};
+    };
+
+    /**
+     * Coût des requêtes d'une signature sur une frame (voir Manager::queryStats()).
+     * Toujours nul si l'instrumentation n'est pas compilée (ECS_QUERY_STATS).
+     */
+    struct QueryStats {
+        // Nombre de requêtes (forEntitiesMatching, forChunksMatching, forPairsMatching)
+        std::size_t calls{0};
+        // Entités examinées et entités correspondant à la signature
+        std::size_t visited{0};
+        std::size_t matched{0};
+        // Durée cumulée des requêtes, traitement des entités compris
+        std::int64_t nanoseconds{0};
+
+        /**
+         * Part des entités examinées qui correspondent : une requête fréquente peu sélective
+         * mérite une requête mise en cache ou un index par tag.
+         */
+        [[nodiscard]] auto selectivity() const noexcept -> double {
+            return visited == 0 ? 0.0 : static_cast<double>(matched) / static_cast<double>(visited);
+        }
+    };
+
+    /**
+     * Photographie de l'état d'un Manager (voir Manager::stats()).
+     * Structure de taille fixe : l'échantillonnage ne fait aucune allocation.
+     *
+     * @tparam TSettings Paramétrage ECS
+     */
+    template<typename TSettings>
+    struct ManagerStats {
+        // Entités vivantes (size), créées depuis le dernier refresh incluses (sizeNext), allouées (capacity)
+        std::size_t size{0};
+        std::size_t sizeNext{0};
+        std::size_t capacity{0};
+
+        // Octets alloués pour la table des entités (bits d'activation compris) et la table des handles
+        std::size_t entityTableBytes{0};
+        std::size_t handleTableBytes{0};
+
+        // Une entrée par composant, dans l'ordre de la ComponentList
+        std::array<ColumnStats, static_cast<std::size_t>(TSettings::componentCount())> columns{};
+
+        // Nombre d'entités vivantes correspondant à chaque signature, dans l'ordre de la SignatureList
+        std::array<std::size_t, static_cast<std::size_t>(TSettings::signatureCount())> signatureMatches{};
+
+        // Entités dont les composants ne sont pas à leur index (dataIndex != index de l'entité)
+        std::size_t outOfOrder{0};
+
+        // Entités vivantes désactivées (voir Manager::setEnabled), exclues de signatureMatches
+        std::size_t disabled{0};
+
+        // Octets alloués pour les valeurs des composants partagés (ecs::Shared<T>)
+        std::size_t sharedBytes{0};
+
+        // Octets alloués pour les index des porteurs de chaque tag
+        std::size_t tagIndexBytes{0};
+
+        // Nombre d'agrandissements du stockage, allocation initiale comprise
+        std::size_t growthCount{0};
+
+        /**
+         * Part des entités vivantes dont les composants ne sont pas à leur index : plus elle est
+         * élevée, moins les itérations par blocs (forChunksMatching) sont efficaces.
+         */
+        [[nodiscard]] auto fragmentation() const noexcept -> double {
+            return size == 0 ? 0.0 : static_cast<double>(outOfOrder) / static_cast<double>(size);
+        }
+
+        /**
+         * Total des octets alloués (tables, colonnes, valeurs partagées et index des tags)
+         */
+        [[nodiscard]] auto totalBytes() const noexcept -> std::size_t {
+            auto bytes(entityTableBytes + handleTableBytes + sharedBytes + tagIndexBytes);
+            for (const auto &column: columns) {
+                bytes += column.allocatedBytes;
+            }
+            return bytes;
+        }
+    };
+
+}
+
+#endif //ECS_MANAGER_STATS_H
@@ -0,0 +1,238 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_ROLLBACK_H
+#define ECS_ROLLBACK_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ecs {
+
+    /**
+     * Historique des derniers états d'un Manager (rollback réseau, relecture instantanée).
+     *
+     * Seul le dernier état enregistré est conservé en entier (snapshot binaire, voir Snapshot.h).
+     * Les états précédents sont stockés sous forme de deltas XOR épars entre deux snapshots
+     * consécutifs : seules les plages de mots de 8 octets qui diffèrent sont conservées, la
+     * mémoire de l'historique est donc proportionnelle au nombre d'octets modifiés.
+     *
+     * Le temps, lui, reste proportionnel à la taille du monde : record() sérialise tout le
+     * Manager puis compare les deux snapshots mot à mot, et rollback(k) applique les k derniers
+     * deltas (coût proportionnel aux octets modifiés) avant de recharger le snapshot complet
+     * obtenu (Manager::loadSnapshot). Le Manager ne suit pas les chunks modifiés : les parcours
+     * écrivent les composants sans marquer de tick.
+     *
+     * Les deltas sont rangés dans un anneau de taille fixe dont les tampons sont réutilisés :
+     * une fois l'anneau rempli, record() n'alloue plus tant que le monde ne grossit pas.
+     *
+     * Comme pour Manager::loadSnapshot, aucun observateur n'est notifié au rollback : les
+     * structures dérivées du monde (ecs::Hierarchy, ...) doivent être réinitialisées par l'appelant.
+     *
+     * @tparam TManager Type du Manager
+     */
+    template<typename TManager>
+    class Rollback {
+        using Word = std::uint64_t;
+
+        /**
+         * Plage de mots modifiés entre deux snapshots
+         */
+        struct Run {
+            std::uint32_t offset;
+            std::uint32_t count;
+        };
+
+        /**
+         * Delta entre un état et le suivant (XOR des deux snapshots complétés par des zéros)
+         */
+        struct Delta {
+            std::size_t previousSize{0};
+            std::vector<Run> runs;
+            std::vector<Word> words;
+        };
+
+        TManager &manager_;
+
+        /**
+         * Dernier état enregistré (snapshot complet, taille arrondie au mot supérieur)
+         */
+        std::vector<std::byte> latest_;
+        std::size_t latestSize_{0};
+
+        /**
+         * Tampon du snapshot en cours d'enregistrement
+         */
+        std::vector<std::byte> scratch_;
+
+        /**
+         * Anneau des deltas : deltas_[(head_ - 1 - i) % capacity] mène de l'état i + 1 frames
+         * en arrière à l'état i frames en arrière
+         */
+        std::vector<Delta> deltas_;
+        std::size_t head_{0};
+        std::size_t history_{0};
+        bool recorded_{false};
+
+        static auto wordCount(const std::size_t bytes) noexcept -> std::size_t {
+            return (bytes + sizeof(Word) - 1) / sizeof(Word);
+        }
+
+        static auto loadWord(const std::byte *data) noexcept -> Word {
+            Word word;
+            std::memcpy(&word, data, sizeof(Word));
+            return word;
+        }
+
+        /**
+         * Calcule le delta entre latest_ et scratch_ (mêmes tailles, arrondies au mot)
+         */
+        auto diff(Delta &delta) -> void {
+            delta.previousSize = latestSize_;
+            delta.runs.clear();
+            delta.words.clear();
+
+            const auto count(latest_.size() / sizeof(Word));
+            for (std::size_t i{0}; i < count; ++i) {
+                const auto word(loadWord(latest_.data() + i * sizeof(Word)) ^
+                                loadWord(scratch_.data() + i * sizeof(Word)));
+                if (word == 0) continue;
+
+                if (!delta.runs.empty() && delta.runs.back().offset + delta.runs.back().count == i) {
+                    ++delta.runs.back().count;
+                } else {
+                    delta.runs.push_back(Run{static_cast<std::uint32_t>(i), 1});
+                }
+                delta.words.push_back(word);
+            }
+        }
+
+        /**
+         * Applique un delta à latest_ : revient à l'état précédent
+         */
+        auto undo(const Delta &delta) noexcept -> void {
+            const auto *word(delta.words.data());
+            for (const auto &run: delta.runs) {
+                auto *data(latest_.data() + run.offset * sizeof(Word));
+                for (std::uint32_t i{0}; i < run.count; ++i, ++word, data += sizeof(Word)) {
+                    const auto value(loadWord(data) ^ *word);
+                    std::memcpy(data, &value, sizeof(Word));
+                }
+            }
+            latestSize_ = delta.previousSize;
+        }
+
+    public:
+        /**
+         * @param manager Manager dont l'état est enregistré
+         * @param frame_count Nombre de frames pouvant être annulées
+         */
+        Rollback(TManager &manager, const std::size_t frame_count) : manager_{manager}, deltas_(frame_count) {
+            assert(frame_count > 0);
+        }
+
+        Rollback(const Rollback &) = delete;
+        Rollback &operator=(const Rollback &) = delete;
+
+        /**
+         * Enregistre l'état courant du Manager comme état le plus récent (typiquement en fin de
+         * frame, après refresh). Le plus ancien état est oublié si l'historique est plein.
+         * Coût : un snapshot complet et une comparaison de tout le monde.
+         */
+        auto record() -> void {
+            scratch_.clear();
+            manager_.saveSnapshot(scratch_);
+            const auto size(scratch_.size());
+
+            if (!recorded_) {
+                std::swap(latest_, scratch_);
+                latest_.resize(wordCount(size) * sizeof(Word));
+                latestSize_ = size;
+                recorded_ = true;
+                return;
+            }
+
+            // Les deux snapshots sont complétés par des zéros jusqu'à la même taille
+            const auto padded(std::max(wordCount(size), latest_.size() / sizeof(Word)) * sizeof(Word));
+            latest_.resize(padded);
+            scratch_.resize(padded);
+
+            diff(deltas_[head_]);
+            head_ = (head_ + 1) % deltas_.size();
+            history_ = std::min(history_ + 1, deltas_.size());
+
+            std::swap(latest_, scratch_);
+            latest_.resize(wordCount(size) * sizeof(Word));
+            latestSize_ = size;
+        }
+
+        /**
+         * Restaure l'état enregistré frames frames avant le dernier (0 : le dernier état).
+         * Les états plus récents sont oubliés : l'état restauré devient le dernier état.
+         * Coût : les octets des deltas annulés, puis le rechargement complet du Manager.
+         *
+         * @param frames Nombre de frames à annuler (au plus size())
+         * @return false si l'historique est insuffisant (le Manager n'est pas modifié)
+         */
+        auto rollback(const std::size_t frames) -> bool {
+            if (!recorded_ || frames > history_) return false;
+
+            for (std::size_t i{0}; i < frames; ++i) {
+                head_ = (head_ + deltas_.size() - 1) % deltas_.size();
+                const auto &delta(deltas_[head_]);
+
+                // Le delta couvre la plus grande des deux tailles
+                latest_.resize(std::max(latest_.size(), wordCount(delta.previousSize) * sizeof(Word)));
+                undo(delta);
+            }
+            history_ -= frames;
+            latest_.resize(wordCount(latestSize_) * sizeof(Word));
+
+            return manager_.loadSnapshot(std::span<const std::byte>(latest_).first(latestSize_));
+        }
+
+        /**
+         * Nombre de frames pouvant être annulées
+         */
+        [[nodiscard]] auto size() const noexcept -> std::size_t {
+            return history_;
+        }
+
+        /**
+         * Nombre maximal de frames pouvant être annulées
+         */
+        [[nodiscard]] auto capacity() const noexcept -> std::size_t {
+            return deltas_.size();
+        }
+
+        /**
+         * Taille (en octets) des deltas conservés, hors dernier état
+         */
+        [[nodiscard]] auto deltaBytes() const noexcept -> std::size_t {
+            std::size_t bytes{0};
+            for (std::size_t i{0}; i < history_; ++i) {
+                const auto &delta(deltas_[(head_ + deltas_.size() - 1 - i) % deltas_.size()]);
+                bytes += delta.runs.size() * sizeof(Run) + delta.words.size() * sizeof(Word);
+            }
+            return bytes;
+        }
+
+        /**
+         * Oublie tout l'historique (par exemple après un chargement de partie)
+         */
+        auto clear() noexcept -> void {
+            head_ = history_ = 0;
+            recorded_ = false;
+        }
+    };
+
+}
+
+#endif //ECS_ROLLBACK_H
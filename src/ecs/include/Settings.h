@@ -6,9 +6,12 @@
 #define ECS_SETTINGS_H
 
 #include <bitset>
+#include <cstddef>
+#include <utility>
 
 #include "impl/SignatureBitsets.h"
 #include "impl/SignatureBitsetsStorage.h"
+#include "impl/SystemSchedule.h"
 #include "tools/TypeList.h"
 
 namespace ecs {
@@ -23,12 +26,18 @@ namespace ecs {
      * @tparam TComponents Liste des composants
      * @tparam TTagList Liste des tags
      * @tparam TSignatureList Liste des signatures (ecs::Signature<C0, C1, C2, ...>)
+     * @tparam TSystemList Liste des systèmes (ecs::System<ecs::Reads<...>, ecs::Writes<...>>)
+     * @tparam TResourceList Liste des ressources (données uniques du monde, hors entités)
+     * @tparam TGroupList Liste des groupes possédants (signatures imbriquées, voir Manager::forGroup)
      */
     template
     <
         tools::ValidTypeList TComponents,
         tools::ValidTypeList TTagList,
-        tools::ValidTypeList TSignatureList
+        tools::ValidTypeList TSignatureList,
+        tools::ValidTypeList TSystemList = tools::TypeList<>,
+        tools::ValidTypeList TResourceList = tools::TypeList<>,
+        tools::ValidTypeList TGroupList = tools::TypeList<>
     >
     struct Settings
     {
@@ -38,7 +47,23 @@ namespace ecs {
         using TagList = struct TTagList::TypeList;
         // SignatureList = TypeList<ecs:Signature<>, ecs:Signature<S0, S1>, ecs:Signature<S0, S3, ...>, ...>
         using SignatureList = struct TSignatureList::TypeList;
-        using ThisType = Settings<ComponentList, TagList, SignatureList>;
+        // SystemList = TypeList<S0, S1, S2, ...>
+        using SystemList = struct TSystemList::TypeList;
+        // ResourceList = TypeList<R0, R1, R2, ...>
+        using ResourceList = struct TResourceList::TypeList;
+        // GroupList = TypeList<ecs::Signature<C0, C1>, ecs::Signature<C0, C1, T0>, ...>
+        using GroupList = struct TGroupList::TypeList;
+        using ThisType = Settings<ComponentList, TagList, SignatureList, SystemList, ResourceList, GroupList>;
+
+        static_assert(!tools::intersects_v<ResourceList, ComponentList>, "A Resource cannot also be a Component");
+        static_assert(tools::includes_v<GroupList, SignatureList>, "A Group must be a Signature");
+        // Les membres d'un groupe occupent le début des colonnes : deux groupes ne peuvent
+        // coexister que si chacun est inclus dans le suivant (du plus large au plus restrictif)
+        static_assert([]<std::size_t... TIndexes>(std::index_sequence<TIndexes...>) {
+                          return (tools::includes_v<tools::at_t<TIndexes, GroupList>,
+                                                    tools::at_t<TIndexes + 1, GroupList>> && ...);
+                      }(std::make_index_sequence<tools::size_v<GroupList> == 0 ? 0 : tools::size_v<GroupList> - 1>{}),
+                      "Each Group must include the previous one (ordered from the widest to the narrowest)");
 
         // SignatureBitsets = SignatureBitsets<
         //    Settings<
@@ -56,6 +81,8 @@ namespace ecs {
         //    >
         // >
         using SignatureBitsetsStorage = impl::SignatureBitsetsStorage<ThisType>;
+        // SystemSchedule = SystemSchedule<Settings<..., TypeList<S0, S1, S2, ...>>>
+        using SystemSchedule = impl::SystemSchedule<ThisType>;
 
         /**
          * Vérifie si un type donné est présent dans la liste des composants
@@ -90,6 +117,39 @@ namespace ecs {
             return tools::contains_v<TSignature, SignatureList>;
         }
 
+        /**
+         * Vérifie si un type donné est présent dans la liste des systèmes
+         * @tparam TSystem Type à contrôler
+         * @return true si le type donné est bien présent dans la liste des systèmes
+         */
+        template<typename TSystem>
+        static constexpr bool isSystem() noexcept
+        {
+            return tools::contains_v<TSystem, SystemList>;
+        }
+
+        /**
+         * Vérifie si un type donné est présent dans la liste des ressources
+         * @tparam TResource Type à contrôler
+         * @return true si le type donné est bien présent dans la liste des ressources
+         */
+        template<typename TResource>
+        static constexpr bool isResource() noexcept
+        {
+            return tools::contains_v<TResource, ResourceList>;
+        }
+
+        /**
+         * Vérifie si une signature donnée est un groupe possédant
+         * @tparam TSignature Signature à contrôler
+         * @return true si la signature est présente dans la liste des groupes
+         */
+        template<typename TSignature>
+        static constexpr bool isGroup() noexcept
+        {
+            return tools::contains_v<TSignature, GroupList>;
+        }
+
         /**
          * Récupère le nombre de composants
          * @return Nombre de composants
@@ -117,6 +177,33 @@ namespace ecs {
             return tools::size<SignatureList>::value;
         }
 
+        /**
+         * Récupère le nombre de systèmes
+         * @return Nombre de systèmes
+         */
+        static constexpr std::int32_t systemCount() noexcept
+        {
+            return tools::size<SystemList>::value;
+        }
+
+        /**
+         * Récupère le nombre de ressources
+         * @return Nombre de ressources
+         */
+        static constexpr std::int32_t resourceCount() noexcept
+        {
+            return tools::size<ResourceList>::value;
+        }
+
+        /**
+         * Récupère le nombre de groupes possédants
+         * @return Nombre de groupes
+         */
+        static constexpr std::int32_t groupCount() noexcept
+        {
+            return tools::size<GroupList>::value;
+        }
+
         /**
          * Récupère l'indice du composant dans la liste des composants
          * @tparam TComponent Type de composant
@@ -153,6 +240,30 @@ namespace ecs {
             return tools::index_of<TSignature, SignatureList>::value;
         }
 
+        /**
+         * Récupère l'indice du système dans la liste des systèmes
+         * @tparam TSystem Type de système
+         * @return Identifiant unique du système dans la liste (son indice); -1 si non
+         * présent dans la liste
+         */
+        template<typename TSystem>
+        static constexpr std::int32_t systemID() noexcept
+        {
+            return tools::index_of<TSystem, SystemList>::value;
+        }
+
+        /**
+         * Récupère l'indice du groupe dans la liste des groupes
+         * @tparam TSignature Signature du groupe
+         * @return Identifiant unique du groupe dans la liste (son indice); -1 si non
+         * présent dans la liste
+         */
+        template<typename TSignature>
+        static constexpr std::int32_t groupID() noexcept
+        {
+            return tools::index_of<TSignature, GroupList>::value;
+        }
+
         using Bitset = std::bitset<componentCount() + tagCount()>;
 
         /**
@@ -0,0 +1,207 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_SNAPSHOT_H
+#define ECS_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "tools/AlignedAllocator.h"
+#include "tools/TypeList.h"
+
+namespace ecs {
+
+    // Snapshot
+    // /   Image binaire complète d'un Manager : métadonnées des entités, table des handles,
+    // /   colonnes de composants, horodatages et ressources.
+    // /
+    // /   Format (même plateforme, même build) :
+    // /     SnapshotHeader
+    // /     entités, handles          (copie brute)
+    // /     bits d'activation         (copie brute, un mot de 64 bits par 64 entités)
+    // /     pour chaque composant :
+    // /       colonne                 (copie brute, alignée sur tools::ColumnAlignment)
+    // /         ou valeurs des entités possédant le composant (SnapshotCodec<T>)
+    // /       horodatages             (copie brute)
+    // /     ressources                (copie brute ou SnapshotCodec<T>)
+    // /
+    // /   Les colonnes sont alignées par rapport au début du blob : un blob chargé à une
+    // /   adresse alignée (fichier projeté en mémoire, par exemple) peut être relu
+    // /   directement, sans copie intermédiaire.
+    // /
+    // /   Avec SnapshotExternalColumns, les colonnes copiables en bloc et les horodatages ne
+    // /   sont pas écrits : ils sont dans les fichiers projetés du Manager (voir
+    // /   Manager::saveMapped).
+
+    /**
+     * Version du format de snapshot, à incrémenter à chaque changement de format
+     */
+    inline constexpr std::uint32_t SnapshotVersion = 3;
+
+    /**
+     * Signature magique d'un snapshot ("ECSS")
+     */
+    inline constexpr std::uint32_t SnapshotMagic = 0x53534345;
+
+    /**
+     * Indicateur d'en-tête : colonnes copiables et horodatages absents du blob (fichiers projetés)
+     */
+    inline constexpr std::uint32_t SnapshotExternalColumns = 1u << 0;
+
+    /**
+     * En-tête d'un snapshot
+     */
+    struct SnapshotHeader {
+        std::uint32_t magic;
+        std::uint32_t version;
+        // Empreinte de la structure des Settings (nombre et taille des types)
+        std::uint64_t layout;
+        std::uint64_t capacity;
+        std::uint64_t size;
+        std::uint64_t sizeNext;
+        std::uint32_t changeTick;
+        // Indicateurs (SnapshotExternalColumns)
+        std::uint32_t flags;
+    };
+
+    /**
+     * Écriture séquentielle dans un blob de snapshot
+     */
+    class SnapshotWriter {
+        std::vector<std::byte> &blob_;
+
+    public:
+        explicit SnapshotWriter(std::vector<std::byte> &blob) noexcept : blob_{blob} {}
+
+        auto writeBytes(const void *data, const std::size_t count) -> void {
+            const auto offset = blob_.size();
+            blob_.resize(offset + count);
+            if (count > 0) std::memcpy(blob_.data() + offset, data, count);
+        }
+
+        template<typename T>
+        auto write(const T &value) -> void {
+            static_assert(std::is_trivially_copyable_v<T>, "Use a SnapshotCodec for non trivially copyable types");
+            writeBytes(&value, sizeof(T));
+        }
+
+        /**
+         * Complète le blob avec des zéros jusqu'au prochain multiple de l'alignement
+         */
+        auto align(const std::size_t alignment = tools::ColumnAlignment) -> void {
+            blob_.resize((blob_.size() + alignment - 1) / alignment * alignment);
+        }
+    };
+
+    /**
+     * Lecture séquentielle d'un blob de snapshot.
+     * Toute lecture hors limites met le lecteur en échec (les lectures suivantes échouent aussi).
+     */
+    class SnapshotReader {
+        std::span<const std::byte> blob_;
+        std::size_t offset_{0};
+        bool failed_{false};
+
+    public:
+        explicit SnapshotReader(const std::span<const std::byte> blob) noexcept : blob_{blob} {}
+
+        /**
+         * Réserve count octets et retourne leur adresse dans le blob (nullptr en cas d'échec)
+         */
+        auto take(const std::size_t count) noexcept -> const std::byte * {
+            if (failed_ || count > blob_.size() - offset_) {
+                failed_ = true;
+                return nullptr;
+            }
+            const auto *data = blob_.data() + offset_;
+            offset_ += count;
+            return data;
+        }
+
+        auto readBytes(void *data, const std::size_t count) noexcept -> bool {
+            const auto *source = take(count);
+            if (source == nullptr) return false;
+            if (count > 0) std::memcpy(data, source, count);
+            return true;
+        }
+
+        template<typename T>
+        auto read(T &value) noexcept -> bool {
+            static_assert(std::is_trivially_copyable_v<T>, "Use a SnapshotCodec for non trivially copyable types");
+            return readBytes(&value, sizeof(T));
+        }
+
+        auto align(const std::size_t alignment = tools::ColumnAlignment) noexcept -> bool {
+            const auto aligned = (offset_ + alignment - 1) / alignment * alignment;
+            take(aligned - offset_);
+            return !failed_;
+        }
+
+        [[nodiscard]] auto failed() const noexcept -> bool { return failed_; }
+
+        [[nodiscard]] auto remaining() const noexcept -> std::size_t { return failed_ ? 0 : blob_.size() - offset_; }
+    };
+
+    /**
+     * Codec de snapshot d'un type non trivialement copiable. À spécialiser :
+     *
+     *   template<>
+     *   struct ecs::SnapshotCodec<CShape> {
+     *       static void write(ecs::SnapshotWriter &writer, const CShape &shape);
+     *       static void read(ecs::SnapshotReader &reader, CShape &shape);
+     *   };
+     *
+     * @tparam T Type à sérialiser
+     */
+    template<typename T>
+    struct SnapshotCodec;
+
+    template<typename T>
+    concept HasSnapshotCodec = requires(SnapshotWriter &writer, SnapshotReader &reader, const T &in, T &out)
+    {
+        SnapshotCodec<T>::write(writer, in);
+        SnapshotCodec<T>::read(reader, out);
+    };
+
+    /**
+     * Types pouvant être copiés en bloc dans un snapshot (sauf si un codec est fourni)
+     */
+    template<typename T>
+    concept BulkSnapshotable = std::is_trivially_copyable_v<T> && !HasSnapshotCodec<T>;
+
+    template<typename T>
+    concept Snapshotable = BulkSnapshotable<T> || HasSnapshotCodec<T>;
+
+    namespace impl {
+
+        /**
+         * Empreinte d'un type dans la structure d'un snapshot
+         */
+        template<typename T>
+        constexpr auto snapshotLayoutOf(const std::uint64_t seed) noexcept -> std::uint64_t {
+            // FNV-1a sur la taille, l'alignement et le mode d'écriture du type
+            constexpr std::uint64_t prime = 1099511628211ull;
+            auto hash = seed;
+            for (const auto value: {sizeof(T), alignof(T), std::size_t{BulkSnapshotable<T>}}) {
+                hash = (hash ^ value) * prime;
+            }
+            return hash;
+        }
+
+        template<typename... Ts>
+        constexpr auto snapshotLayoutOfAll(std::uint64_t seed, tools::TypeList<Ts...>) noexcept -> std::uint64_t {
+            ((seed = snapshotLayoutOf<Ts>(seed)), ...);
+            return seed;
+        }
+
+    }
+
+}
+
+#endif //ECS_SNAPSHOT_H
@@ -0,0 +1,146 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_TICK_TIERS_H
+#define ECS_TICK_TIERS_H
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+
+namespace ecs {
+
+    /**
+     * Palier de fréquence de mise à jour d'une entité (tick LOD) : l'entité n'est mise à jour
+     * qu'une frame sur (1 << tier). Ce composant doit être déclaré dans la ComponentList des
+     * Settings et n'être modifié qu'au travers de ecs::TickTiers.
+     */
+    struct CTickTier {
+        // Palier : période de 1, 2, 4 ou 8 frames
+        std::uint8_t tier{0};
+        // Décalage dans la période : les entités d'un même palier sont réparties sur les frames
+        std::uint8_t phase{0};
+        // Dernière frame de mise à jour (calcul du temps écoulé)
+        std::uint32_t lastFrame{0};
+    };
+
+    /**
+     * Horloge des paliers de fréquence de mise à jour.
+     *
+     * Un système de distance (ou d'importance) choisit le palier de chaque entité avec
+     * assign ; les systèmes de simulation ne traitent à chaque frame que les entités dues
+     * (isDue) et intègrent le temps réellement écoulé depuis leur dernière mise à jour
+     * (consume), y compris après un changement de palier :
+     *
+     *   tick_tiers.beginFrame(delta_seconds);
+     *   manager.forEntitiesMatching<SMoving>([&](ecs::EntityIndex, CTransform &transform, ecs::CTickTier &tier) {
+     *       if (!tick_tiers.isDue(tier)) return;
+     *       transform.position += transform.velocity * tick_tiers.consume(tier);
+     *   });
+     *
+     * Les décalages sont attribués à tour de rôle : la charge d'un palier est répartie
+     * uniformément sur les frames de sa période.
+     */
+    class TickTiers {
+    public:
+        /**
+         * Nombre de paliers (périodes de 1, 2, 4 et 8 frames)
+         */
+        static constexpr std::uint8_t TierCount{4};
+
+        /**
+         * Période la plus longue (frames) : le temps intégré par consume ne dépasse jamais
+         * cette durée (entité longtemps ignorée, monde restauré depuis un snapshot, ...)
+         */
+        static constexpr std::uint32_t MaxPeriod{1u << (TierCount - 1)};
+
+    private:
+        // Temps cumulé à la fin de chacune des dernières frames (tampon circulaire)
+        static constexpr std::uint32_t HistorySize{2 * MaxPeriod};
+
+        std::array<double, HistorySize> history_{};
+        double now_{0.0};
+        std::uint32_t frame_{0};
+        std::uint8_t nextPhase_{0};
+
+    public:
+        /**
+         * Période (en frames) d'un palier
+         */
+        [[nodiscard]] static constexpr auto periodOf(const std::uint8_t tier) noexcept -> std::uint32_t {
+            return 1u << tier;
+        }
+
+        /**
+         * Démarre une nouvelle frame (une fois par frame, avant les systèmes)
+         *
+         * @param delta_time Durée de la frame
+         */
+        auto beginFrame(const float delta_time) noexcept -> void {
+            ++frame_;
+            now_ += static_cast<double>(delta_time);
+            history_[frame_ % HistorySize] = now_;
+        }
+
+        /**
+         * Initialise le palier d'une entité qui vient d'être créée : elle est due à la frame
+         * courante et sa première mise à jour intègre la durée de la frame.
+         *
+         * @param tick_tier Composant de l'entité
+         * @param tier Palier initial
+         */
+        auto init(CTickTier &tick_tier, const std::uint8_t tier = 0) noexcept -> void {
+            tick_tier.lastFrame = frame_ - 1;
+            tick_tier.tier = 0;
+            tick_tier.phase = 0;
+            assign(tick_tier, tier);
+        }
+
+        /**
+         * Change le palier d'une entité. Le temps écoulé depuis sa dernière mise à jour est
+         * conservé : il sera intégré à sa prochaine mise à jour.
+         *
+         * @param tick_tier Composant de l'entité
+         * @param tier Nouveau palier (inférieur à TierCount)
+         */
+        auto assign(CTickTier &tick_tier, const std::uint8_t tier) noexcept -> void {
+            assert(tier < TierCount);
+            if (tick_tier.tier == tier) return;
+
+            tick_tier.tier = tier;
+            tick_tier.phase = static_cast<std::uint8_t>(nextPhase_++ & (periodOf(tier) - 1));
+        }
+
+        /**
+         * Indique si une entité doit être mise à jour à la frame courante
+         */
+        [[nodiscard]] auto isDue(const CTickTier &tick_tier) const noexcept -> bool {
+            return ((frame_ + tick_tier.phase) & (periodOf(tick_tier.tier) - 1)) == 0;
+        }
+
+        /**
+         * Temps écoulé depuis la dernière mise à jour de l'entité (au plus MaxPeriod frames),
+         * qui est considérée comme mise à jour à la frame courante
+         *
+         * @param tick_tier Composant de l'entité
+         * @return Durée à intégrer (même unité que les delta_time de beginFrame)
+         */
+        auto consume(CTickTier &tick_tier) noexcept -> float {
+            const auto frames(std::min(frame_ - tick_tier.lastFrame, MaxPeriod));
+            tick_tier.lastFrame = frame_;
+            return static_cast<float>(now_ - history_[(frame_ - frames) % HistorySize]);
+        }
+
+        /**
+         * Numéro de la frame courante
+         */
+        [[nodiscard]] auto frame() const noexcept -> std::uint32_t {
+            return frame_;
+        }
+    };
+
+}
+
+#endif //ECS_TICK_TIERS_H
@@ -0,0 +1,60 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_IMPL_CHANGE_TICKS_H
+#define ECS_IMPL_CHANGE_TICKS_H
+
+#include "../EcsTypes.h"
+
+namespace ecs::impl {
+
+    /**
+     * Horodatage d'un composant d'une entité
+     */
+    struct ComponentTicks
+    {
+        /**
+         * Tick auquel le composant a été ajouté
+         */
+        ChangeTick added;
+
+        /**
+         * Tick de la dernière modification du composant
+         */
+        ChangeTick changed;
+    };
+
+    /**
+     * Traits des filtres de requête (ecs::Changed<T>, ecs::Added<T>)
+     *
+     * @tparam TFilter Type de filtre
+     */
+    template<typename TFilter>
+    struct ChangeFilter;
+
+    template<typename T>
+    struct ChangeFilter<Changed<T>>
+    {
+        using Component = T;
+
+        static auto passes(const ComponentTicks &ticks, const ChangeTick since) noexcept -> bool
+        {
+            return ticks.changed > since;
+        }
+    };
+
+    template<typename T>
+    struct ChangeFilter<Added<T>>
+    {
+        using Component = T;
+
+        static auto passes(const ComponentTicks &ticks, const ChangeTick since) noexcept -> bool
+        {
+            return ticks.added > since;
+        }
+    };
+
+}
+
+#endif //ECS_IMPL_CHANGE_TICKS_H
@@ -5,11 +5,18 @@
 #ifndef ECS_IMPL_COMPONENT_STORAGE_H
 #define ECS_IMPL_COMPONENT_STORAGE_H
 
-#include <tuple>
+#include <array>
+#include <filesystem>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "../EcsTypes.h"
-#include "../tools/ForEachType.h"
+#include "../Snapshot.h"
+#include "ChangeTicks.h"
+#include "MappableColumn.h"
+#include "../tools/AlignedAllocator.h"
 #include "../tools/TypeList.h"
 
 namespace ecs::impl {
@@ -30,17 +37,57 @@ namespace ecs::impl {
         // We want to have a single `std::vector` for every
         // component type.
 
-        // We know the types of the components at compile-time.
-        // Therefore, we can use `std::tuple`.
+        // Le début de chaque colonne est aligné sur tools::ColumnAlignment octets ; une plage
+        // commençant ailleurs dans la colonne n'est alignée que sur alignof(T).
+        // Les colonnes copiables en bloc peuvent en outre être projetées depuis un fichier (voir map).
+        template<typename T>
+        using Column = std::conditional_t<BulkSnapshotable<T>,
+            MappableColumn<T>,
+            std::vector<T, tools::AlignedAllocator<T, tools::ColumnAlignment>>>;
+
+        // Une colonne par type de composant, retrouvée par conversion vers la classe de base
+        // ColumnOf<T>. Contrairement à std::get sur un std::tuple (récursif dans la plupart des
+        // implémentations), l'accès ne coûte rien à la compilation même avec 100+ composants.
+        template<typename T>
+        struct ColumnOf {
+            Column<T> column;
+        };
 
         template<typename... Ts>
-        using TupleOfVectors = std::tuple<std::vector<Ts>...>;
+        struct Columns : ColumnOf<Ts>... {
+            template<typename TFunction>
+            auto forEach(TFunction &&function) -> void {
+                (function(static_cast<ColumnOf<Ts> &>(*this).column), ...);
+            }
+        };
+
+        // On cherche ici à produire une structure contenant des vecteurs de composants :
+        // Columns<C1, C2, C3> héritant de ColumnOf<C1>, ColumnOf<C2> et ColumnOf<C3>
+        tools::rename_t<Columns, ComponentList> vectors;
+
+        // Horodatage (ajout / modification) de chaque composant, une colonne par type de composant.
+        std::array<MappableColumn<ComponentTicks>, static_cast<std::size_t>(Settings::componentCount())> ticks;
+
+        // Fichiers d'un type de composant projeté (voir map)
+        template<typename TComponent>
+        static auto columnPath(const std::filesystem::path &directory) -> std::filesystem::path {
+            return directory / ("column_" + std::to_string(Settings::template componentID<TComponent>()) + ".bin");
+        }
+
+        template<typename TComponent>
+        static auto ticksPath(const std::filesystem::path &directory) -> std::filesystem::path {
+            return directory / ("ticks_" + std::to_string(Settings::template componentID<TComponent>()) + ".bin");
+        }
+
+        template<typename TComponent>
+        auto column() noexcept -> Column<TComponent> & {
+            return static_cast<ColumnOf<TComponent> &>(vectors).column;
+        }
 
-        // We need to "unpack" the contents of `ComponentList` in
-        // `TupleOfVectors`.
-        // On cherche ici à produire un tuple contenant des vecteurs de composants :
-        // std::tuple<std::vector<C1>, std::vector<C2>, std::vector<C3>> vectors;
-        tools::rename_t<TupleOfVectors, ComponentList> vectors;
+        template<typename TComponent>
+        auto column() const noexcept -> const Column<TComponent> & {
+            return static_cast<const ColumnOf<TComponent> &>(vectors).column;
+        }
 
         // That's it!
         // We have separate contiguous storage for all component
@@ -58,9 +105,27 @@ namespace ecs::impl {
          * @param new_capacity Nouvelle taille attendue
          */
         auto grow(std::size_t new_capacity) -> void {
-            tools::for_each_type(vectors, [new_capacity](auto &v) {
+            vectors.forEach([new_capacity](auto &v) {
                 v.resize(new_capacity);
             });
+            for (auto &column: ticks) {
+                column.resize(new_capacity);
+            }
+        }
+
+        /**
+         * Méthode permettant d'échanger deux emplacements dans toutes les colonnes (composants et horodatages)
+         * @param a Premier emplacement
+         * @param b Second emplacement
+         */
+        auto swap(const DataIndex a, const DataIndex b) -> void {
+            vectors.forEach([a, b](auto &v) {
+                using std::swap;
+                swap(v[a.get()], v[b.get()]);
+            });
+            for (auto &column: ticks) {
+                std::swap(column[a.get()], column[b.get()]);
+            }
         }
 
         /**
@@ -73,12 +138,157 @@ namespace ecs::impl {
         auto& getComponent(DataIndex index) noexcept
         {
             static_assert(tools::contains_v<TComponent, ComponentList>);
+            return column<TComponent>()[index.get()];
+        }
+
+        /**
+         * Méthode permettant de récupérer l'instance du Composant (const)
+         * @tparam TComponent Type de composant à récupérer
+         * @param index Index du composant dans son vecteur de composant
+         * @return Référence du composant retrouvé (const)
+         */
+        template<typename TComponent>
+        auto getComponent(DataIndex index) const noexcept -> const TComponent &
+        {
+            static_assert(tools::contains_v<TComponent, ComponentList>);
+            return column<TComponent>()[index.get()];
+        }
+
+        /**
+         * Méthode permettant de récupérer l'horodatage d'un Composant en fonction de son type et de son index
+         * @tparam TComponent Type de composant
+         * @param index Index du composant dans son vecteur de composant
+         * @return Référence vers l'horodatage du composant
+         */
+        template<typename TComponent>
+        auto getTicks(DataIndex index) noexcept -> ComponentTicks &
+        {
+            static_assert(tools::contains_v<TComponent, ComponentList>);
+            return ticks[static_cast<std::size_t>(Settings::template componentID<TComponent>())][index.get()];
+        }
+
+        /**
+         * Méthode permettant de récupérer l'horodatage d'un Composant (const)
+         * @tparam TComponent Type de composant
+         * @param index Index du composant dans son vecteur de composant
+         * @return Référence vers l'horodatage du composant (const)
+         */
+        template<typename TComponent>
+        auto getTicks(DataIndex index) const noexcept -> const ComponentTicks &
+        {
+            static_assert(tools::contains_v<TComponent, ComponentList>);
+            return ticks[static_cast<std::size_t>(Settings::template componentID<TComponent>())][index.get()];
+        }
+
+        /**
+         * Méthode permettant de récupérer le début de la colonne d'un type de Composant
+         * @tparam TComponent Type de composant
+         * @return Pointeur vers le premier composant de la colonne (aligné sur tools::ColumnAlignment)
+         */
+        template<typename TComponent>
+        auto data() noexcept -> TComponent *
+        {
+            static_assert(tools::contains_v<TComponent, ComponentList>);
+            return column<TComponent>().data();
+        }
+
+        template<typename TComponent>
+        auto data() const noexcept -> const TComponent *
+        {
+            static_assert(tools::contains_v<TComponent, ComponentList>);
+            return column<TComponent>().data();
+        }
+
+        /**
+         * Méthode permettant de récupérer le début de la colonne d'horodatage d'un type de Composant
+         * @tparam TComponent Type de composant
+         * @return Pointeur vers le premier horodatage de la colonne
+         */
+        template<typename TComponent>
+        auto ticksData() noexcept -> ComponentTicks *
+        {
+            static_assert(tools::contains_v<TComponent, ComponentList>);
+            return ticks[static_cast<std::size_t>(Settings::template componentID<TComponent>())].data();
+        }
 
-            // We need to get the correct vector, depending on `T`.
-            // Compile-time recursion? Nah.
+        template<typename TComponent>
+        auto ticksData() const noexcept -> const ComponentTicks *
+        {
+            static_assert(tools::contains_v<TComponent, ComponentList>);
+            return ticks[static_cast<std::size_t>(Settings::template componentID<TComponent>())].data();
+        }
 
-            // Let's use C++14's `std::get` instead!
-            return std::get<std::vector<TComponent>>(vectors)[index.get()];
+        /**
+         * Méthode permettant de projeter les colonnes d'un type de Composant depuis des fichiers :
+         * la colonne (si le type est copiable en bloc) et ses horodatages.
+         * @tparam TComponent Type de composant
+         * @param directory Répertoire des fichiers (column_<id>.bin, ticks_<id>.bin)
+         * @param keep_content true pour relire le contenu des fichiers, false pour y copier les colonnes
+         * @return false si un fichier ne peut être projeté
+         */
+        template<typename TComponent>
+        auto map(const std::filesystem::path &directory, const bool keep_content) -> bool
+        {
+            static_assert(tools::contains_v<TComponent, ComponentList>);
+            if constexpr (BulkSnapshotable<TComponent>) {
+                if (!column<TComponent>().map(columnPath<TComponent>(directory), keep_content)) return false;
+            }
+            return ticks[static_cast<std::size_t>(Settings::template componentID<TComponent>())]
+                    .map(ticksPath<TComponent>(directory), keep_content);
+        }
+
+        /**
+         * Méthode permettant de vérifier, sans rien projeter, que les fichiers d'un type de
+         * Composant existent et contiennent au moins count éléments
+         * @tparam TComponent Type de composant
+         * @param directory Répertoire des fichiers
+         * @param count Nombre d'éléments attendus
+         * @return true si map(directory, true) retrouvera count éléments
+         */
+        template<typename TComponent>
+        static auto hasFiles(const std::filesystem::path &directory, const std::size_t count) -> bool
+        {
+            static_assert(tools::contains_v<TComponent, ComponentList>);
+            const auto covers = [](const std::filesystem::path &path, const std::size_t bytes) {
+                std::error_code error;
+                const auto file_size(std::filesystem::file_size(path, error));
+                return !error && file_size >= bytes;
+            };
+            if constexpr (BulkSnapshotable<TComponent>) {
+                if (!covers(columnPath<TComponent>(directory), count * sizeof(TComponent))) return false;
+            }
+            return covers(ticksPath<TComponent>(directory), count * sizeof(ComponentTicks));
+        }
+
+        /**
+         * Méthode permettant d'écrire dans leurs fichiers les colonnes projetées d'un type de Composant
+         * @tparam TComponent Type de composant
+         * @return false si l'écriture a échoué
+         */
+        template<typename TComponent>
+        auto sync() const noexcept -> bool
+        {
+            static_assert(tools::contains_v<TComponent, ComponentList>);
+            auto synced(ticks[static_cast<std::size_t>(Settings::template componentID<TComponent>())].sync());
+            if constexpr (BulkSnapshotable<TComponent>) {
+                synced = column<TComponent>().sync() && synced;
+            }
+            return synced;
+        }
+
+        /**
+         * Méthode permettant de savoir si les colonnes d'un type de Composant sont projetées
+         * @tparam TComponent Type de composant
+         * @return true si les horodatages (et la colonne, si le type est copiable en bloc) sont projetés
+         */
+        template<typename TComponent>
+        auto isMapped() const noexcept -> bool
+        {
+            static_assert(tools::contains_v<TComponent, ComponentList>);
+            if constexpr (BulkSnapshotable<TComponent>) {
+                if (!column<TComponent>().isMapped()) return false;
+            }
+            return ticks[static_cast<std::size_t>(Settings::template componentID<TComponent>())].isMapped();
         }
     };
 
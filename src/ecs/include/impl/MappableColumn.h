@@ -0,0 +1,150 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_IMPL_MAPPABLE_COLUMN_H
+#define ECS_IMPL_MAPPABLE_COLUMN_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../tools/AlignedAllocator.h"
+#include "../tools/MappedFile.h"
+
+namespace ecs::impl {
+
+    /**
+     * Colonne d'un type copiable en bloc : en mémoire par défaut, ou projetée depuis un fichier
+     * (voir map). Dans les deux cas l'accès passe par un simple pointeur.
+     *
+     * Une colonne projetée n'initialise pas ses nouveaux éléments (octets à zéro) : les
+     * composants sont construits par Manager::addComponent. La copie d'une colonne est toujours
+     * en mémoire.
+     *
+     * @tparam T Type des éléments (trivially copyable)
+     */
+    template<typename T>
+    class MappableColumn {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable columns can be mapped");
+
+        std::vector<T, tools::AlignedAllocator<T, tools::ColumnAlignment>> heap;
+        tools::MappedFile file;
+        T *items{nullptr};
+        std::size_t count{0};
+
+    public:
+        MappableColumn() noexcept = default;
+
+        MappableColumn(const MappableColumn &other) : heap(other.items, other.items + other.count) {
+            items = heap.data();
+            count = other.count;
+        }
+
+        MappableColumn &operator=(const MappableColumn &other) {
+            if (this != &other) *this = MappableColumn(other);
+            return *this;
+        }
+
+        // Le pointeur est recalculé sur le stockage reçu : la colonne source est laissée vide
+        MappableColumn(MappableColumn &&other) noexcept
+            : heap{std::move(other.heap)}, file{std::move(other.file)}, count{std::exchange(other.count, 0)} {
+            items = file.isOpen() ? reinterpret_cast<T *>(file.data()) : heap.data();
+            other.heap.clear();
+            other.items = nullptr;
+        }
+
+        MappableColumn &operator=(MappableColumn &&other) noexcept {
+            if (this != &other) {
+                heap = std::move(other.heap);
+                file = std::move(other.file);
+                count = std::exchange(other.count, 0);
+                items = file.isOpen() ? reinterpret_cast<T *>(file.data()) : heap.data();
+                other.heap.clear();
+                other.items = nullptr;
+            }
+            return *this;
+        }
+
+        /**
+         * Agrandit la colonne (ou le fichier projeté)
+         *
+         * @throws std::bad_alloc si le fichier projeté ne peut être étendu
+         */
+        auto resize(const std::size_t new_count) -> void {
+            if (file.isOpen()) {
+                if (new_count * sizeof(T) > file.size() && !file.resize(new_count * sizeof(T))) throw std::bad_alloc{};
+                items = reinterpret_cast<T *>(file.data());
+            } else {
+                heap.resize(new_count);
+                items = heap.data();
+            }
+            count = new_count;
+        }
+
+        /**
+         * Projette la colonne depuis un fichier, créé si besoin.
+         *
+         * @param path Fichier de la colonne
+         * @param keep_content true : le contenu du fichier est conservé (réouverture d'un monde
+         *                     enregistré) ; false : il est remplacé par celui de la colonne
+         * @return false si le fichier ne peut être projeté (la colonne reste inchangée)
+         */
+        auto map(const std::filesystem::path &path, const bool keep_content) -> bool {
+            tools::MappedFile mapped;
+            if (!mapped.open(path)) return false;
+
+            const auto bytes(count * sizeof(T));
+            if (keep_content) {
+                if (mapped.size() < bytes && !mapped.resize(bytes)) return false;
+            } else {
+                if (!mapped.resize(bytes)) return false;
+                if (bytes > 0) std::memcpy(mapped.data(), static_cast<const void *>(items), bytes);
+            }
+
+            file = std::move(mapped);
+            decltype(heap)().swap(heap);
+            items = reinterpret_cast<T *>(file.data());
+            return true;
+        }
+
+        /**
+         * Écrit les éléments modifiés dans le fichier (sans effet pour une colonne en mémoire)
+         */
+        auto sync() const noexcept -> bool {
+            return !file.isOpen() || file.sync();
+        }
+
+        [[nodiscard]] auto isMapped() const noexcept -> bool {
+            return file.isOpen();
+        }
+
+        [[nodiscard]] auto size() const noexcept -> std::size_t {
+            return count;
+        }
+
+        [[nodiscard]] auto data() noexcept -> T * {
+            return items;
+        }
+
+        [[nodiscard]] auto data() const noexcept -> const T * {
+            return items;
+        }
+
+        [[nodiscard]] auto operator[](const std::size_t index) noexcept -> T & {
+            return items[index];
+        }
+
+        [[nodiscard]] auto operator[](const std::size_t index) const noexcept -> const T & {
+            return items[index];
+        }
+    };
+
+}
+
+#endif //ECS_IMPL_MAPPABLE_COLUMN_H
@@ -0,0 +1,303 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_IMPL_OBSERVERS_H
+#define ECS_IMPL_OBSERVERS_H
+
+#include <array>
+#include <cassert>
+#include <functional>
+#include <vector>
+
+#include "../EcsTypes.h"
+#include "../tools/ForEachType.h"
+
+namespace ecs::impl {
+
+    /**
+     * Nombre maximum d'observateurs par événement (par composant ou par tag)
+     */
+    inline constexpr std::size_t MaxObserversPerEvent = 8;
+
+    /**
+     * Table fixe d'observateurs d'un événement.
+     *
+     * Chaque observateur est un couple (pointeur de fonction, contexte) : aucune allocation
+     * n'est faite à l'enregistrement ni à la notification.
+     *
+     * @tparam TManager Type du Manager notifié
+     */
+    template<typename TManager>
+    class HookTable
+    {
+    public:
+        using Function = void (*)(void *, TManager &, EntityIndex);
+
+    private:
+        struct Hook
+        {
+            Function function{nullptr};
+            void *context{nullptr};
+        };
+
+        std::array<Hook, MaxObserversPerEvent> hooks{};
+        std::size_t count{0};
+
+    public:
+        auto add(const Function function, void *context) noexcept -> void
+        {
+            assert(count < MaxObserversPerEvent && "Too many observers for this event");
+            hooks[count++] = Hook{function, context};
+        }
+
+        /**
+         * Retire tous les observateurs enregistrés avec ce contexte
+         * @param context Contexte des observateurs à retirer
+         * @return Nombre d'observateurs retirés
+         */
+        auto remove(const void *context) noexcept -> std::size_t
+        {
+            std::size_t kept{0};
+            for (std::size_t i = 0; i < count; ++i) {
+                if (hooks[i].context != context) hooks[kept++] = hooks[i];
+            }
+            const auto removed = count - kept;
+            count = kept;
+            return removed;
+        }
+
+        [[nodiscard]] auto empty() const noexcept -> bool { return count == 0; }
+
+        auto dispatch(TManager &manager, const EntityIndex entity_index) const -> void
+        {
+            for (std::size_t i = 0; i < count; ++i) {
+                hooks[i].function(hooks[i].context, manager, entity_index);
+            }
+        }
+    };
+
+    /**
+     * Adaptateur typé permettant de stocker n'importe quel observateur sous la forme d'un
+     * pointeur de fonction. TFunction est invoquée avec (TContext &, TManager &, EntityIndex) :
+     * il peut s'agir d'une fonction libre, d'un lambda sans capture ou d'une fonction membre
+     * de TContext.
+     */
+    template<typename TManager, auto TFunction, typename TContext>
+    auto invokeHook(void *context, TManager &manager, const EntityIndex entity_index) -> void
+    {
+        std::invoke(TFunction, *static_cast<TContext *>(context), manager, entity_index);
+    }
+
+    /**
+     * Observateurs des événements du Manager et événements en attente de notification.
+     *
+     * Les événements ne sont enregistrés que si au moins un observateur est concerné ; ils
+     * sont notifiés par lots lors du refresh(), avant le compactage des entités. Sans
+     * observateur, le coût se limite à un test par événement.
+     *
+     * @tparam TSettings Paramétrage ECS
+     * @tparam TManager Type du Manager notifié
+     */
+    template<typename TSettings, typename TManager>
+    class Observers
+    {
+        using Settings = TSettings;
+        using Table = HookTable<TManager>;
+        using Queue = std::vector<EntityIndex>;
+
+        static constexpr auto componentCount = static_cast<std::size_t>(Settings::componentCount());
+        static constexpr auto tagCount = static_cast<std::size_t>(Settings::tagCount());
+
+        std::array<Table, componentCount> addHooks, removeHooks;
+        std::array<Table, tagCount> tagAddedHooks;
+        Table killedHooks;
+
+        // Nombre total d'observateurs onRemove (un kill doit être enregistré s'il y en a)
+        std::size_t removeHookCount{0};
+
+        std::array<Queue, componentCount> pendingAdded, pendingRemoved;
+        std::array<Queue, tagCount> pendingTagAdded;
+        Queue pendingKilled;
+
+        bool pending{false};
+        bool dispatching{false};
+        // Événements ignorés (création concurrente : ils sont rejoués au point de synchronisation)
+        bool suspended{false};
+
+        template<typename TComponent>
+        static constexpr auto componentIndex() noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(Settings::template componentID<TComponent>());
+        }
+
+        template<typename TTag>
+        static constexpr auto tagIndex() noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(Settings::template tagID<TTag>());
+        }
+
+        auto push(Queue &queue, const EntityIndex entity_index) -> void
+        {
+            if (suspended) return;
+            queue.push_back(entity_index);
+            pending = true;
+        }
+
+        /**
+         * Notifie les événements d'une file. Les observateurs peuvent produire de nouveaux
+         * événements pendant la notification : ils sont traités dans le même refresh().
+         */
+        template<typename TDispatch>
+        static auto drain(Queue &queue, TDispatch &&dispatch) -> void
+        {
+            for (std::size_t i = 0; i < queue.size(); ++i) {
+                dispatch(EntityIndex{queue[i]});
+            }
+            queue.clear();
+        }
+
+    public:
+        template<typename TComponent>
+        auto onAdd(const typename Table::Function function, void *context) noexcept -> void
+        {
+            addHooks[componentIndex<TComponent>()].add(function, context);
+        }
+
+        template<typename TComponent>
+        auto onRemove(const typename Table::Function function, void *context) noexcept -> void
+        {
+            removeHooks[componentIndex<TComponent>()].add(function, context);
+            ++removeHookCount;
+        }
+
+        template<typename TTag>
+        auto onTagAdded(const typename Table::Function function, void *context) noexcept -> void
+        {
+            tagAddedHooks[tagIndex<TTag>()].add(function, context);
+        }
+
+        auto onKilled(const typename Table::Function function, void *context) noexcept -> void
+        {
+            killedHooks.add(function, context);
+        }
+
+        auto remove(const void *context) noexcept -> void
+        {
+            for (auto &table: addHooks) table.remove(context);
+            for (auto &table: removeHooks) removeHookCount -= table.remove(context);
+            for (auto &table: tagAddedHooks) table.remove(context);
+            killedHooks.remove(context);
+        }
+
+        template<typename TComponent>
+        auto componentAdded(const EntityIndex entity_index) -> void
+        {
+            constexpr auto index = componentIndex<TComponent>();
+            if (!addHooks[index].empty()) push(pendingAdded[index], entity_index);
+        }
+
+        template<typename TComponent>
+        auto componentRemoved(const EntityIndex entity_index) -> void
+        {
+            constexpr auto index = componentIndex<TComponent>();
+            if (!removeHooks[index].empty()) push(pendingRemoved[index], entity_index);
+        }
+
+        template<typename TTag>
+        auto tagAdded(const EntityIndex entity_index) -> void
+        {
+            constexpr auto index = tagIndex<TTag>();
+            if (!tagAddedHooks[index].empty()) push(pendingTagAdded[index], entity_index);
+        }
+
+        auto killed(const EntityIndex entity_index) -> void
+        {
+            if (!killedHooks.empty() || removeHookCount > 0) push(pendingKilled, entity_index);
+        }
+
+        [[nodiscard]] auto hasPending() const noexcept -> bool { return pending; }
+
+        /**
+         * Suspend (ou rétablit) l'enregistrement des événements
+         */
+        auto suspend(const bool value) noexcept -> void { suspended = value; }
+
+        /**
+         * Oublie les événements en attente (utilisé par Manager::clear())
+         */
+        auto clearPending() noexcept -> void
+        {
+            for (auto &queue: pendingAdded) queue.clear();
+            for (auto &queue: pendingRemoved) queue.clear();
+            for (auto &queue: pendingTagAdded) queue.clear();
+            pendingKilled.clear();
+            pending = false;
+        }
+
+        /**
+         * Notifie tous les événements en attente, dans l'ordre : ajouts de composants, ajouts
+         * de tags, retraits de composants, puis entités tuées (précédées d'un onRemove pour
+         * chaque composant qu'elles possèdent encore).
+         *
+         * Un événement annulé avant le refresh() n'est pas notifié (composant retiré, entité
+         * tuée entre-temps, ...).
+         *
+         * @param manager Manager notifié
+         */
+        auto dispatch(TManager &manager) -> void
+        {
+            assert(!dispatching && "refresh() cannot be called from an observer");
+            dispatching = true;
+
+            while (pending) {
+                pending = false;
+
+                tools::for_each_type<typename Settings::ComponentList>([this, &manager]<typename TComponent>() {
+                    const auto &hooks(addHooks[componentIndex<TComponent>()]);
+                    drain(pendingAdded[componentIndex<TComponent>()], [&](const EntityIndex entity_index) {
+                        if (manager.isAlive(entity_index) && manager.template hasComponent<TComponent>(entity_index)) {
+                            hooks.dispatch(manager, entity_index);
+                        }
+                    });
+                });
+
+                tools::for_each_type<typename Settings::TagList>([this, &manager]<typename TTag>() {
+                    const auto &hooks(tagAddedHooks[tagIndex<TTag>()]);
+                    drain(pendingTagAdded[tagIndex<TTag>()], [&](const EntityIndex entity_index) {
+                        if (manager.isAlive(entity_index) && manager.template hasTag<TTag>(entity_index)) {
+                            hooks.dispatch(manager, entity_index);
+                        }
+                    });
+                });
+
+                tools::for_each_type<typename Settings::ComponentList>([this, &manager]<typename TComponent>() {
+                    const auto &hooks(removeHooks[componentIndex<TComponent>()]);
+                    drain(pendingRemoved[componentIndex<TComponent>()], [&](const EntityIndex entity_index) {
+                        if (!manager.template hasComponent<TComponent>(entity_index)) {
+                            hooks.dispatch(manager, entity_index);
+                        }
+                    });
+                });
+
+                drain(pendingKilled, [this, &manager](const EntityIndex entity_index) {
+                    if (removeHookCount > 0) {
+                        tools::for_each_type<typename Settings::ComponentList>(
+                            [this, &manager, entity_index]<typename TComponent>() {
+                                const auto &hooks(removeHooks[componentIndex<TComponent>()]);
+                                if (!hooks.empty() && manager.template hasComponent<TComponent>(entity_index)) {
+                                    hooks.dispatch(manager, entity_index);
+                                }
+                            });
+                    }
+                    killedHooks.dispatch(manager, entity_index);
+                });
+            }
+
+            dispatching = false;
+        }
+    };
+
+}
+
+#endif //ECS_IMPL_OBSERVERS_H
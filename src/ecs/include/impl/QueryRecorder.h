@@ -0,0 +1,118 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_IMPL_QUERY_RECORDER_H
+#define ECS_IMPL_QUERY_RECORDER_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "../ManagerStats.h"
+
+// Instrumentation des requêtes (voir Manager::queryStats) : 0 (défaut) ou 1.
+// Désactivée, les sondes sont vides et disparaissent à la compilation. Toutes les unités de
+// compilation d'un programme doivent utiliser la même valeur (option CMake ECS_QUERY_STATS).
+#ifndef ECS_QUERY_STATS
+#define ECS_QUERY_STATS 0
+#endif
+
+namespace ecs {
+
+    /**
+     * Instrumentation des requêtes compilée (ECS_QUERY_STATS)
+     */
+    inline constexpr bool QueryStatsEnabled{ECS_QUERY_STATS != 0};
+
+}
+
+namespace ecs::impl {
+
+#if ECS_QUERY_STATS
+
+    /**
+     * Sonde d'une requête : compte localement les entités visitées et correspondantes, puis
+     * reporte les compteurs et la durée de la requête à sa destruction.
+     */
+    class QueryProbe {
+        QueryStats &stats;
+        std::chrono::steady_clock::time_point start;
+        std::size_t visited{0};
+        std::size_t matched{0};
+
+    public:
+        explicit QueryProbe(QueryStats &query_stats) noexcept
+            : stats{query_stats}, start{std::chrono::steady_clock::now()} {}
+
+        ~QueryProbe() {
+            ++stats.calls;
+            stats.visited += visited;
+            stats.matched += matched;
+            stats.nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count();
+        }
+
+        QueryProbe(const QueryProbe &) = delete;
+        QueryProbe &operator=(const QueryProbe &) = delete;
+
+        auto visit(const std::size_t count = 1) noexcept -> void { visited += count; }
+        auto match(const std::size_t count = 1) noexcept -> void { matched += count; }
+    };
+
+    /**
+     * Statistiques des requêtes par signature : frame en cours et dernière frame terminée
+     *
+     * @tparam TSignatureCount Nombre de signatures
+     */
+    template<std::size_t TSignatureCount>
+    class QueryRecorder {
+        std::array<QueryStats, TSignatureCount> current{};
+        std::array<QueryStats, TSignatureCount> last{};
+
+    public:
+        [[nodiscard]] auto probe(const std::size_t signature_id) noexcept -> QueryProbe {
+            return QueryProbe{current[signature_id]};
+        }
+
+        auto endFrame() noexcept -> void {
+            last = current;
+            current = {};
+        }
+
+        [[nodiscard]] auto lastFrame() const noexcept -> const std::array<QueryStats, TSignatureCount> & {
+            return last;
+        }
+    };
+
+#else
+
+    /**
+     * Sonde vide : instrumentation désactivée
+     */
+    class QueryProbe {
+    public:
+        auto visit(std::size_t = 1) noexcept -> void {}
+        auto match(std::size_t = 1) noexcept -> void {}
+    };
+
+    template<std::size_t TSignatureCount>
+    class QueryRecorder {
+        static constexpr std::array<QueryStats, TSignatureCount> empty{};
+
+    public:
+        [[nodiscard]] auto probe(std::size_t) noexcept -> QueryProbe { return {}; }
+
+        auto endFrame() noexcept -> void {}
+
+        [[nodiscard]] auto lastFrame() const noexcept -> const std::array<QueryStats, TSignatureCount> & {
+            return empty;
+        }
+    };
+
+#endif
+
+}
+
+#endif //ECS_IMPL_QUERY_RECORDER_H
@@ -0,0 +1,222 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_IMPL_SHARED_POOL_H
+#define ECS_IMPL_SHARED_POOL_H
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "../EcsTypes.h"
+#include "../Snapshot.h"
+#include "../tools/TypeList.h"
+
+namespace ecs::impl {
+
+    /**
+     * Indique si un composant est un composant partagé (ecs::Shared<T>)
+     */
+    template<typename T>
+    struct IsShared : std::false_type {
+    };
+
+    template<typename T>
+    struct IsShared<Shared<T>> : std::true_type {
+    };
+
+    /**
+     * Type fourni par les requêtes pour un composant : une référence vers le composant, ou
+     * une référence constante vers la valeur partagée pour un ecs::Shared<T>
+     */
+    template<typename T>
+    struct QueryArgument {
+        using type = T &;
+    };
+
+    template<typename T>
+    struct QueryArgument<Shared<T>> {
+        using type = const T &;
+    };
+
+    template<typename T>
+    using QueryArgument_t = typename QueryArgument<T>::type;
+
+    /**
+     * Valeurs d'un composant partagé, dédupliquées et comptées par référence.
+     *
+     * Un emplacement dont le compteur tombe à zéro est recyclé par l'acquisition suivante
+     * d'une valeur absente. La déduplication compare la valeur acquise à toutes les valeurs
+     * vivantes (operator==) : elle est prévue pour quelques valeurs distinctes partagées par
+     * de nombreuses entités.
+     *
+     * @tparam T Type de la valeur partagée
+     */
+    template<typename T>
+    class SharedPool {
+        static_assert(std::equality_comparable<T>, "A shared value must be equality comparable");
+
+        std::vector<T> values;
+        std::vector<std::uint32_t> refCounts;
+        std::vector<std::uint32_t> freeSlots;
+
+    public:
+        /**
+         * Référence une valeur : l'emplacement d'une valeur égale est réutilisé s'il existe
+         *
+         * @return Index de la valeur
+         */
+        auto acquire(const T &value) -> std::uint32_t {
+            for (std::uint32_t index{0}; index < values.size(); ++index) {
+                if (refCounts[index] > 0 && values[index] == value) {
+                    ++refCounts[index];
+                    return index;
+                }
+            }
+
+            if (!freeSlots.empty()) {
+                const auto index(freeSlots.back());
+                freeSlots.pop_back();
+                values[index] = value;
+                refCounts[index] = 1;
+                return index;
+            }
+
+            values.push_back(value);
+            refCounts.push_back(1);
+            return static_cast<std::uint32_t>(values.size() - 1);
+        }
+
+        /**
+         * Libère une référence : l'emplacement est recyclé quand plus aucune entité ne l'utilise
+         */
+        auto release(const std::uint32_t index) -> void {
+            assert(index < refCounts.size() && refCounts[index] > 0);
+            if (--refCounts[index] == 0) freeSlots.push_back(index);
+        }
+
+        [[nodiscard]] auto get(const std::uint32_t index) const noexcept -> const T & {
+            assert(index < values.size() && refCounts[index] > 0);
+            return values[index];
+        }
+
+        [[nodiscard]] auto get(const std::uint32_t index) noexcept -> T & {
+            assert(index < values.size() && refCounts[index] > 0);
+            return values[index];
+        }
+
+        [[nodiscard]] auto refCount(const std::uint32_t index) const noexcept -> std::uint32_t {
+            return index < refCounts.size() ? refCounts[index] : 0;
+        }
+
+        /**
+         * Nombre de valeurs distinctes référencées
+         */
+        [[nodiscard]] auto liveCount() const noexcept -> std::size_t {
+            return values.size() - freeSlots.size();
+        }
+
+        [[nodiscard]] auto allocatedBytes() const noexcept -> std::size_t {
+            return values.capacity() * sizeof(T) +
+                   (refCounts.capacity() + freeSlots.capacity()) * sizeof(std::uint32_t);
+        }
+
+        auto clear() noexcept -> void {
+            values.clear();
+            refCounts.clear();
+            freeSlots.clear();
+        }
+
+        auto save(SnapshotWriter &writer) const -> void {
+            writer.write(static_cast<std::uint64_t>(values.size()));
+            writer.writeBytes(refCounts.data(), refCounts.size() * sizeof(std::uint32_t));
+            for (const auto &value: values) {
+                if constexpr (BulkSnapshotable<T>) {
+                    writer.write(value);
+                } else {
+                    SnapshotCodec<T>::write(writer, value);
+                }
+            }
+        }
+
+        /**
+         * Relit les valeurs écrites par save (le pool doit être vide)
+         *
+         * @return false si le blob est tronqué
+         */
+        auto load(SnapshotReader &reader) -> bool {
+            std::uint64_t count{0};
+            if (!reader.read(count) || count > reader.remaining() / sizeof(std::uint32_t)) return false;
+
+            refCounts.resize(static_cast<std::size_t>(count));
+            values.resize(static_cast<std::size_t>(count));
+            if (!reader.readBytes(refCounts.data(), refCounts.size() * sizeof(std::uint32_t))) return false;
+
+            for (std::uint32_t index{0}; index < values.size() && !reader.failed(); ++index) {
+                if constexpr (BulkSnapshotable<T>) {
+                    reader.read(values[index]);
+                } else {
+                    SnapshotCodec<T>::read(reader, values[index]);
+                }
+                if (refCounts[index] == 0) freeSlots.push_back(index);
+            }
+            return !reader.failed();
+        }
+    };
+
+    /**
+     * Un SharedPool par composant partagé de la ComponentList, retrouvé par conversion vers la
+     * classe de base PoolOf<T> (comme les colonnes de ComponentStorage)
+     *
+     * @tparam TShared Composants partagés (ecs::Shared<T>)
+     */
+    template<typename... TShared>
+    class SharedPools {
+        template<typename T>
+        struct PoolOf {
+            SharedPool<T> pool;
+        };
+
+        struct Pools : PoolOf<typename TShared::Type>... {
+        };
+
+        Pools pools;
+
+    public:
+        // Values = TypeList<T0, T1, ...>
+        using Values = tools::TypeList<typename TShared::Type...>;
+
+        template<typename T>
+        [[nodiscard]] auto get() noexcept -> SharedPool<T> & {
+            return static_cast<PoolOf<T> &>(pools).pool;
+        }
+
+        template<typename T>
+        [[nodiscard]] auto get() const noexcept -> const SharedPool<T> & {
+            return static_cast<const PoolOf<T> &>(pools).pool;
+        }
+
+        auto clear() noexcept -> void {
+            (get<typename TShared::Type>().clear(), ...);
+        }
+
+        [[nodiscard]] auto allocatedBytes() const noexcept -> std::size_t {
+            return (std::size_t{0} + ... + get<typename TShared::Type>().allocatedBytes());
+        }
+
+        auto save(SnapshotWriter &writer) const -> void {
+            (get<typename TShared::Type>().save(writer), ...);
+        }
+
+        auto load(SnapshotReader &reader) -> bool {
+            return (get<typename TShared::Type>().load(reader) && ...);
+        }
+    };
+
+}
+
+#endif //ECS_IMPL_SHARED_POOL_H
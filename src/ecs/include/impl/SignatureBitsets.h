@@ -5,7 +5,7 @@
 #ifndef ECS_IMPL_SIGNATURE_BITSETS_H
 #define ECS_IMPL_SIGNATURE_BITSETS_H
 
-#include <tuple>
+#include <array>
 
 #include "../tools/TypeList.h"
 
@@ -28,9 +28,9 @@ namespace ecs::impl {
         // Bitset = std::bitset<componentCount() + tagCount()>
         using Bitset = typename Settings::Bitset;
 
-        // BitsetStorage = TypeList<Bitset, Bitset, ...>>
-        // BitsetStorage = TypeList<std::bitset<componentCount() + tagCount()>, std::bitset<componentCount() + tagCount()>, ...>>
-        using BitsetStorage = typename tools::repeat<Settings::signatureCount(), Bitset, std::tuple<>>::type;
+        // BitsetStorage = std::array<Bitset, signatureCount()>
+        // BitsetStorage = std::array<std::bitset<componentCount() + tagCount()>, signatureCount()>
+        using BitsetStorage = std::array<Bitset, static_cast<std::size_t>(Settings::signatureCount())>;
 
         /**
          * Indique si le type permet un filtre sur les composants
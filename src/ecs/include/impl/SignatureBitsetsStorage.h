@@ -5,7 +5,7 @@
 #ifndef ECS_IMP_SIGNATURE_BITSETS_STORAGE_H
 #define ECS_IMP_SIGNATURE_BITSETS_STORAGE_H
 
-#include <tuple>
+#include <cstddef>
 
 #include "../tools/ForEachType.h"
 
@@ -29,8 +29,7 @@ namespace ecs::impl {
         using SignatureBitsets = typename Settings::SignatureBitsets;
         // SignatureList = TypeList<ecs::Signature<C0, C1>, ecs::Signature<C0, C3, ...>, ...>
         using SignatureList = typename SignatureBitsets::SignatureList;
-        // BitsetStorage = TypeList<Bitset, Bitset, ...>>
-        // BitsetStorage = TypeList<std::bitset<componentCount() + tagCount()>, std::bitset<componentCount() + tagCount()>, ...>>
+        // BitsetStorage = std::array<Bitset, signatureCount()>
         using BitsetStorage = typename SignatureBitsets::BitsetStorage;
 
         BitsetStorage storage;
@@ -44,7 +43,7 @@ namespace ecs::impl {
         template<typename TSignature>
         auto &getSignatureBitset() noexcept {
             static_assert(Settings::template isSignature<TSignature>());
-            return std::get<Settings::template signatureID<TSignature>()>(storage);
+            return storage[static_cast<std::size_t>(Settings::template signatureID<TSignature>())];
         }
 
         /**
@@ -55,7 +54,7 @@ namespace ecs::impl {
         template<typename TSignature>
         const auto &getSignatureBitset() const noexcept {
             static_assert(Settings::template isSignature<TSignature>());
-            return std::get<Settings::template signatureID<TSignature>()>(storage);
+            return storage[static_cast<std::size_t>(Settings::template signatureID<TSignature>())];
         }
 
     private:
@@ -0,0 +1,229 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_IMPL_SYSTEM_SCHEDULE_H
+#define ECS_IMPL_SYSTEM_SCHEDULE_H
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+#include "../EcsTypes.h"
+#include "../tools/ForEachType.h"
+#include "../tools/TypeList.h"
+
+namespace ecs::impl {
+
+    /**
+     * Ordonnancement des systèmes calculé à la compilation.
+     *
+     * Chaque système déclare ses accès (ecs::Reads<...> / ecs::Writes<...>) aux composants
+     * et aux ressources. Deux systèmes sont en conflit si l'un écrit un type que l'autre lit
+     * ou écrit, ou si l'un modifie la structure du monde (ecs::Writes<ecs::Entities>). Un système est placé dans l'étape qui suit la dernière étape contenant un
+     * système en conflit déclaré avant lui dans la SystemList : l'ordre de la liste est donc
+     * respecté entre systèmes en conflit, et les systèmes d'une même étape peuvent être
+     * exécutés en parallèle.
+     *
+     * @tparam TSettings Paramétrage ECS
+     */
+    template<typename TSettings>
+    struct SystemSchedule
+    {
+        // Settings = Settings<ComponentList, TagList, SignatureList, SystemList, ResourceList>
+        using Settings = TSettings;
+        // ThisType = SystemSchedule<Settings<ComponentList, TagList, SignatureList, SystemList>>
+        using ThisType = SystemSchedule;
+        // SystemList = TypeList<S0, S1, S2, ...>
+        using SystemList = typename Settings::SystemList;
+
+        /**
+         * Indique si tous les types d'une liste d'accès sont connus des Settings
+         * @tparam TAccessList TypeList des types accédés
+         * @return true si tous les types sont des composants, des ressources ou ecs::Entities
+         */
+        template<typename TAccessList>
+        static constexpr bool isValidAccessList() noexcept
+        {
+            return []<typename... Ts>(tools::TypeList<Ts...>) {
+                return ((Settings::template isComponent<Ts>() || Settings::template isResource<Ts>() ||
+                         std::is_same_v<Ts, Entities>) && ...);
+            }(TAccessList{});
+        }
+
+        /**
+         * Indique si un système modifie la structure du monde (ecs::Writes<ecs::Entities>)
+         * @tparam TSystem Système
+         */
+        template<typename TSystem>
+        static constexpr bool isStructural() noexcept
+        {
+            return tools::contains_v<Entities, typename TSystem::WriteList>;
+        }
+
+        /**
+         * Détermine si deux systèmes ne peuvent pas être exécutés en même temps
+         * @tparam TSystemA Premier système
+         * @tparam TSystemB Second système
+         * @return true si l'un des systèmes écrit un type accédé par l'autre ou modifie la
+         *         structure du monde
+         */
+        template<typename TSystemA, typename TSystemB>
+        static constexpr bool conflicts() noexcept
+        {
+            using ReadsA = typename TSystemA::ReadList;
+            using WritesA = typename TSystemA::WriteList;
+            using ReadsB = typename TSystemB::ReadList;
+            using WritesB = typename TSystemB::WriteList;
+
+            static_assert(isValidAccessList<ReadsA>() && isValidAccessList<WritesA>(),
+                          "System accesses must be declared Components or Resources");
+            static_assert(isValidAccessList<ReadsB>() && isValidAccessList<WritesB>(),
+                          "System accesses must be declared Components or Resources");
+
+            return isStructural<TSystemA>() || isStructural<TSystemB>()
+                   || tools::intersects_v<WritesA, WritesB>
+                   || tools::intersects_v<WritesA, ReadsB>
+                   || tools::intersects_v<ReadsA, WritesB>;
+        }
+
+    private:
+        static constexpr std::size_t count = tools::size_v<SystemList>;
+
+        /**
+         * Construit la matrice (count x count) des conflits entre systèmes
+         */
+        template<std::size_t... TIndexes>
+        static constexpr auto conflictMatrix(std::index_sequence<TIndexes...>) noexcept
+            -> std::array<bool, sizeof...(TIndexes)>
+        {
+            return {
+                conflicts<
+                    tools::at_t<TIndexes / count, SystemList>,
+                    tools::at_t<TIndexes % count, SystemList>
+                >()...
+            };
+        }
+
+        /**
+         * Calcule l'étape de chaque système (dans l'ordre de la SystemList)
+         */
+        static constexpr auto computeStages() noexcept -> std::array<std::size_t, count>
+        {
+            constexpr auto matrix = conflictMatrix(std::make_index_sequence<count * count>{});
+
+            std::array<std::size_t, count> result{};
+            for (std::size_t i = 0; i < count; ++i) {
+                std::size_t stage = 0;
+                for (std::size_t j = 0; j < i; ++j) {
+                    if (matrix[i * count + j] && result[j] + 1 > stage) {
+                        stage = result[j] + 1;
+                    }
+                }
+                result[i] = stage;
+            }
+            return result;
+        }
+
+        static constexpr std::array<std::size_t, count> stages = computeStages();
+
+    public:
+        /**
+         * Récupère le nombre d'étapes de l'ordonnancement
+         * @return Nombre d'étapes (0 si aucun système)
+         */
+        static constexpr std::size_t stageCount() noexcept
+        {
+            std::size_t result = 0;
+            for (const auto stage: stages) {
+                if (stage + 1 > result) result = stage + 1;
+            }
+            return result;
+        }
+
+        /**
+         * Récupère l'étape dans laquelle le système est exécuté
+         * @tparam TSystem Type de système
+         * @return Indice de l'étape
+         */
+        template<typename TSystem>
+        static constexpr std::size_t stageOf() noexcept
+        {
+            static_assert(Settings::template isSystem<TSystem>(), "TSystem must be a System");
+            return stages[static_cast<std::size_t>(Settings::template systemID<TSystem>())];
+        }
+
+        /**
+         * Indique si deux systèmes sont exécutés dans la même étape (et donc potentiellement en parallèle)
+         * @tparam TSystemA Premier système
+         * @tparam TSystemB Second système
+         * @return true si les deux systèmes partagent la même étape
+         */
+        template<typename TSystemA, typename TSystemB>
+        static constexpr bool isSameStage() noexcept
+        {
+            return stageOf<TSystemA>() == stageOf<TSystemB>();
+        }
+
+        /**
+         * Prédicat permettant de filtrer les systèmes d'une étape
+         * @tparam TStage Indice de l'étape
+         */
+        template<std::size_t TStage>
+        struct InStage
+        {
+            template<typename TSystem>
+            using Predicate = std::bool_constant<stageOf<TSystem>() == TStage>;
+        };
+
+        /**
+         * Retourne le tools::TypeList des systèmes d'une étape (dans l'ordre de la SystemList)
+         *
+         * @tparam TStage Indice de l'étape
+         */
+        template<std::size_t TStage>
+        using StageSystems = tools::filter_t<SystemList, InStage<TStage>::template Predicate>;
+
+    private:
+        template<typename TFunction, std::size_t... TStages>
+        static void forEachStageImpl(TFunction &function, std::index_sequence<TStages...>)
+        {
+            (function.template operator()<TStages, StageSystems<TStages>>(), ...);
+        }
+
+    public:
+        /**
+         * Invoque la fonction pour chaque étape, dans l'ordre.
+         * La fonction doit avoir la forme : []<std::size_t TStage, typename TStageSystems>() { ... }
+         *
+         * @tparam TFunction Type de la fonction
+         * @param function Fonction à invoquer
+         */
+        template<typename TFunction>
+        static void forEachStage(TFunction &&function)
+        {
+            forEachStageImpl(function, std::make_index_sequence<stageCount()>{});
+        }
+
+        /**
+         * Invoque la fonction pour chaque système, étape par étape.
+         * La fonction doit avoir la forme : []<typename TSystem>() { ... }
+         *
+         * Tout est résolu à la compilation : aucun graphe n'est construit à l'exécution
+         * et aucun appel virtuel n'est nécessaire.
+         *
+         * @tparam TFunction Type de la fonction
+         * @param function Fonction à invoquer
+         */
+        template<typename TFunction>
+        static void forEachSystem(TFunction &&function)
+        {
+            forEachStage([&function]<std::size_t, typename TStageSystems>() {
+                tools::for_each_type<TStageSystems>(function);
+            });
+        }
+    };
+
+}
+
+#endif //ECS_IMPL_SYSTEM_SCHEDULE_H
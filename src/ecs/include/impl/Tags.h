@@ -10,6 +10,7 @@ namespace ecs::impl {
     struct EntityIndexTag;
     struct HandleDataIndexTag;
     struct CounterTag;
+    struct ChangeTickTag;
 }
 
 #endif //ECS_IMPL_TAGS_H
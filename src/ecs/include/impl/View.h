@@ -0,0 +1,127 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_IMPL_VIEW_H
+#define ECS_IMPL_VIEW_H
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <tuple>
+
+#include "../EcsTypes.h"
+#include "../tools/TypeList.h"
+#include "SharedPool.h"
+
+namespace ecs::impl {
+
+    template<typename TManager, typename TSignature, typename TComponentList>
+    class View;
+
+    /**
+     * Vue (au sens std::ranges) sur les entités correspondant à une signature.
+     *
+     * Chaque élément est un proxy std::tuple<EntityIndex, C0&, C1&, ...> contenant l'index
+     * de l'entité suivi d'une référence vers chaque composant de la signature (sans les tags),
+     * dans l'ordre de la signature. La vue est une forward_range : elle peut alimenter les
+     * algorithmes std::ranges (find_if, count_if, any_of, ...) et se décompose avec les
+     * structured bindings :
+     *
+     *   for (auto [entity_index, transform, shape] : manager.view<SRendering>()) { ... }
+     *
+     * La vue est invalidée par refresh() et par toute création d'entité.
+     *
+     * @tparam TManager Type du Manager
+     * @tparam TSignature Signature utilisée pour filtrer les entités
+     * @tparam TComponents Composants de la signature (sans les tags)
+     */
+    template<typename TManager, typename TSignature, typename... TComponents>
+    class View<TManager, TSignature, tools::TypeList<TComponents...>>
+        : public std::ranges::view_interface<View<TManager, TSignature, tools::TypeList<TComponents...>>>
+    {
+    public:
+        // value_type = std::tuple<EntityIndex, C0&, C1&, ...>
+        // (const T& pour un composant partagé ecs::Shared<T>)
+        using value_type = std::tuple<EntityIndex, QueryArgument_t<TComponents>...>;
+
+        class Iterator
+        {
+            TManager *manager_{nullptr};
+            std::size_t index_{0};
+            std::size_t end_{0};
+
+            /**
+             * Avance jusqu'à la prochaine entité correspondant à la signature (ou la fin)
+             */
+            auto skipNonMatching() noexcept -> void
+            {
+                while (index_ < end_ && !manager_->template matchesSignature<TSignature>(EntityIndex{index_})) {
+                    ++index_;
+                }
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = View::value_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = value_type;
+            using pointer = void;
+
+            Iterator() noexcept = default;
+
+            Iterator(TManager *manager, const std::size_t index, const std::size_t end) noexcept
+                : manager_{manager}, index_{index}, end_{end}
+            {
+                skipNonMatching();
+            }
+
+            auto operator*() const noexcept -> reference
+            {
+                const EntityIndex entity_index{index_};
+                const auto &data_index(manager_->getEntity(entity_index).dataIndex);
+
+                return reference{entity_index, manager_->queryValue(manager_->components.template getComponent<TComponents>(data_index))...};
+            }
+
+            auto operator++() noexcept -> Iterator &
+            {
+                ++index_;
+                skipNonMatching();
+                return *this;
+            }
+
+            auto operator++(int) noexcept -> Iterator
+            {
+                auto previous(*this);
+                ++*this;
+                return previous;
+            }
+
+            friend auto operator==(const Iterator &lhs, const Iterator &rhs) noexcept -> bool
+            {
+                return lhs.index_ == rhs.index_;
+            }
+        };
+
+    private:
+        TManager *manager_{nullptr};
+        std::size_t end_{0};
+
+    public:
+        View() noexcept = default;
+
+        View(TManager &manager, const std::size_t end) noexcept : manager_{&manager}, end_{end} {}
+
+        [[nodiscard]] auto begin() const noexcept -> Iterator { return Iterator{manager_, 0, end_}; }
+
+        [[nodiscard]] auto end() const noexcept -> Iterator { return Iterator{manager_, end_, end_}; }
+    };
+
+}
+
+// Les itérateurs ne référencent que le Manager : ils restent valides après destruction de la vue
+template<typename TManager, typename TSignature, typename TComponentList>
+inline constexpr bool std::ranges::enable_borrowed_range<ecs::impl::View<TManager, TSignature, TComponentList>> = true;
+
+#endif //ECS_IMPL_VIEW_H
@@ -0,0 +1,57 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_TOOLS_ALIGNED_ALLOCATOR_H
+#define ECS_TOOLS_ALIGNED_ALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+
+namespace ecs::tools {
+
+    /**
+     * Alignement (en octets) du début de chaque colonne de composants.
+     * 64 octets = une ligne de cache, et couvre les besoins AVX2 (32) / AVX-512 (64).
+     */
+    constexpr std::size_t ColumnAlignment = 64;
+
+    /**
+     * Allocateur garantissant l'alignement du bloc alloué
+     *
+     * @tparam T Type des éléments alloués
+     * @tparam TAlignment Alignement minimal (en octets) du bloc alloué
+     */
+    template<typename T, std::size_t TAlignment>
+    struct AlignedAllocator {
+        using value_type = T;
+
+        static constexpr std::align_val_t alignment{TAlignment > alignof(T) ? TAlignment : alignof(T)};
+
+        template<typename U>
+        struct rebind {
+            using other = AlignedAllocator<U, TAlignment>;
+        };
+
+        AlignedAllocator() noexcept = default;
+
+        template<typename U>
+        AlignedAllocator(const AlignedAllocator<U, TAlignment> &) noexcept {}
+
+        [[nodiscard]] auto allocate(const std::size_t n) -> T * {
+            return static_cast<T *>(::operator new(n * sizeof(T), alignment));
+        }
+
+        auto deallocate(T *pointer, const std::size_t n) noexcept -> void {
+            ::operator delete(pointer, n * sizeof(T), alignment);
+        }
+
+        template<typename U>
+        friend auto operator==(const AlignedAllocator &, const AlignedAllocator<U, TAlignment> &) noexcept -> bool {
+            return true;
+        }
+    };
+
+}
+
+#endif //ECS_TOOLS_ALIGNED_ALLOCATOR_H
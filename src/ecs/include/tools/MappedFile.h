@@ -0,0 +1,172 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_TOOLS_MAPPED_FILE_H
+#define ECS_TOOLS_MAPPED_FILE_H
+
+#include <cstddef>
+#include <filesystem>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ECS_MAPPED_FILE_POSIX 1
+#else
+#define ECS_MAPPED_FILE_POSIX 0
+#endif
+
+namespace ecs::tools {
+
+    /**
+     * Fichier projeté en mémoire (lecture / écriture, partagé) : le système charge les pages à
+     * la demande et les réécrit dans le fichier.
+     *
+     * Disponible sur les systèmes POSIX uniquement (Supported) ; ailleurs open() échoue.
+     * L'agrandissement étend le fichier puis le reprojette : l'adresse des données peut changer.
+     */
+    class MappedFile {
+#if ECS_MAPPED_FILE_POSIX
+        int fd_{-1};
+#endif
+        std::byte *data_{nullptr};
+        std::size_t size_{0};
+
+        auto unmap() noexcept -> void {
+#if ECS_MAPPED_FILE_POSIX
+            if (data_ != nullptr) ::munmap(data_, size_);
+#endif
+            data_ = nullptr;
+            size_ = 0;
+        }
+
+        auto map([[maybe_unused]] const std::size_t bytes) noexcept -> bool {
+            unmap();
+#if ECS_MAPPED_FILE_POSIX
+            if (bytes == 0) return true;
+
+            void *address(::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0));
+            if (address == MAP_FAILED) return false;
+#ifdef MADV_HUGEPAGE
+            // Simple indication : ignorée si le système de fichiers ne sait pas utiliser de pages géantes
+            ::madvise(address, bytes, MADV_HUGEPAGE);
+#endif
+            data_ = static_cast<std::byte *>(address);
+            size_ = bytes;
+            return true;
+#else
+            return false;
+#endif
+        }
+
+    public:
+        /**
+         * Projection de fichiers disponible sur cette plateforme
+         */
+        static constexpr bool Supported{ECS_MAPPED_FILE_POSIX != 0};
+
+        MappedFile() noexcept = default;
+
+        ~MappedFile() {
+            close();
+        }
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        MappedFile(MappedFile &&other) noexcept
+            :
+#if ECS_MAPPED_FILE_POSIX
+              fd_{std::exchange(other.fd_, -1)},
+#endif
+              data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)} {}
+
+        MappedFile &operator=(MappedFile &&other) noexcept {
+            if (this != &other) {
+                close();
+#if ECS_MAPPED_FILE_POSIX
+                fd_ = std::exchange(other.fd_, -1);
+#endif
+                data_ = std::exchange(other.data_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+            }
+            return *this;
+        }
+
+        /**
+         * Ouvre (ou crée) un fichier et le projette en entier
+         *
+         * @return false si le fichier ne peut être ouvert ou projeté
+         */
+        auto open([[maybe_unused]] const std::filesystem::path &path) -> bool {
+            close();
+#if ECS_MAPPED_FILE_POSIX
+            fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+            if (fd_ < 0) return false;
+
+            struct stat status{};
+            if (::fstat(fd_, &status) != 0 || !map(static_cast<std::size_t>(status.st_size))) {
+                close();
+                return false;
+            }
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /**
+         * Change la taille du fichier (les octets ajoutés valent zéro) et le reprojette
+         *
+         * @return false si le fichier ne peut être étendu ou projeté
+         */
+        auto resize(const std::size_t bytes) noexcept -> bool {
+            if (bytes == size_) return true;
+#if ECS_MAPPED_FILE_POSIX
+            if (::ftruncate(fd_, static_cast<off_t>(bytes)) != 0) return false;
+#endif
+            return map(bytes);
+        }
+
+        /**
+         * Écrit les pages modifiées dans le fichier (appel bloquant)
+         */
+        auto sync() const noexcept -> bool {
+#if ECS_MAPPED_FILE_POSIX
+            return data_ == nullptr || ::msync(data_, size_, MS_SYNC) == 0;
+#else
+            return false;
+#endif
+        }
+
+        auto close() noexcept -> void {
+            unmap();
+#if ECS_MAPPED_FILE_POSIX
+            if (fd_ >= 0) ::close(fd_);
+            fd_ = -1;
+#endif
+        }
+
+        [[nodiscard]] auto isOpen() const noexcept -> bool {
+#if ECS_MAPPED_FILE_POSIX
+            return fd_ >= 0;
+#else
+            return false;
+#endif
+        }
+
+        [[nodiscard]] auto data() const noexcept -> std::byte * {
+            return data_;
+        }
+
+        [[nodiscard]] auto size() const noexcept -> std::size_t {
+            return size_;
+        }
+    };
+
+}
+
+#endif //ECS_TOOLS_MAPPED_FILE_H
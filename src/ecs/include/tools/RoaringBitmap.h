@@ -0,0 +1,521 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_TOOLS_ROARING_BITMAP_H
+#define ECS_TOOLS_ROARING_BITMAP_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+namespace ecs::tools {
+
+    /**
+     * Ensemble compressé d'entiers 32 bits (bitmap « roaring »).
+     *
+     * Les valeurs sont réparties par blocs de 65536 selon leurs 16 bits de poids fort ; chaque
+     * bloc non vide est un conteneur adapté à sa densité :
+     *   - tableau trié des 16 bits de poids faible (au plus ArrayMax valeurs) ;
+     *   - bitmap de 65536 bits (8 Kio) au-delà ;
+     *   - plages [début, début + longueur] après optimize(), si c'est plus compact.
+     *
+     * La mémoire est donc proportionnelle au nombre de valeurs pour un ensemble creux, et
+     * bornée à 8 Kio par bloc pour un ensemble dense. Intersections et unions travaillent
+     * conteneur par conteneur, sans parcourir les blocs absents de l'un des deux ensembles.
+     */
+    class RoaringBitmap {
+    public:
+        using Value = std::uint32_t;
+
+        /**
+         * Nombre maximal de valeurs d'un conteneur tableau (au-delà, un bitmap est plus compact)
+         */
+        static constexpr std::size_t ArrayMax{4096};
+
+    private:
+        static constexpr std::size_t BitmapWords{65536 / 64};
+
+        enum class Kind : std::uint8_t {
+            Array,
+            Bitmap,
+            Run
+        };
+
+        struct Container {
+            std::uint16_t key{0};
+            Kind kind{Kind::Array};
+            std::uint32_t cardinality{0};
+            // Array : valeurs triées ; Run : paires (début, longueur - 1) triées
+            std::vector<std::uint16_t> values;
+            // Bitmap : BitmapWords mots
+            std::vector<std::uint64_t> words;
+
+            [[nodiscard]] auto runCount() const noexcept -> std::size_t {
+                return values.size() / 2;
+            }
+
+            [[nodiscard]] auto contains(const std::uint16_t low) const noexcept -> bool {
+                switch (kind) {
+                    case Kind::Array:
+                        return std::binary_search(values.begin(), values.end(), low);
+                    case Kind::Bitmap:
+                        return ((words[low / 64] >> (low % 64)) & 1) != 0;
+                    case Kind::Run:
+                        return findRun(low) < runCount();
+                }
+                return false;
+            }
+
+            /**
+             * Plage contenant low ou, à défaut, première plage située après low
+             *
+             * @return Index de la plage, runCount() si aucune
+             */
+            [[nodiscard]] auto findRun(const std::uint16_t low) const noexcept -> std::size_t {
+                std::size_t first{0}, last{runCount()};
+                while (first < last) {
+                    const auto middle((first + last) / 2);
+                    if (values[2 * middle] + values[2 * middle + 1] < low) {
+                        first = middle + 1;
+                    } else {
+                        last = middle;
+                    }
+                }
+                return first;
+            }
+
+            /**
+             * Plus petite valeur du conteneur supérieure ou égale à low
+             */
+            [[nodiscard]] auto nextFrom(const std::uint32_t low) const noexcept -> std::optional<std::uint16_t> {
+                if (low > 0xFFFF) return std::nullopt;
+
+                switch (kind) {
+                    case Kind::Array: {
+                        const auto it(std::lower_bound(values.begin(), values.end(), low));
+                        if (it != values.end()) return *it;
+                        break;
+                    }
+                    case Kind::Bitmap: {
+                        auto word_index(low / 64);
+                        auto word(words[word_index] & (~std::uint64_t{0} << (low % 64)));
+                        while (word == 0) {
+                            if (++word_index == BitmapWords) return std::nullopt;
+                            word = words[word_index];
+                        }
+                        return static_cast<std::uint16_t>(word_index * 64 + static_cast<std::uint32_t>(std::countr_zero(word)));
+                    }
+                    case Kind::Run: {
+                        const auto run(findRun(static_cast<std::uint16_t>(low)));
+                        if (run < runCount()) return static_cast<std::uint16_t>(std::max<std::uint32_t>(values[2 * run], low));
+                        break;
+                    }
+                }
+                return std::nullopt;
+            }
+
+            template<typename TF>
+            auto forEach(TF &&mFunction) const -> void {
+                const auto high(static_cast<Value>(key) << 16);
+                switch (kind) {
+                    case Kind::Array:
+                        for (const auto low: values) mFunction(high | low);
+                        break;
+                    case Kind::Bitmap:
+                        for (std::size_t word_index{0}; word_index < BitmapWords; ++word_index) {
+                            auto word(words[word_index]);
+                            while (word != 0) {
+                                mFunction(high | static_cast<Value>(word_index * 64 + static_cast<std::size_t>(std::countr_zero(word))));
+                                word &= word - 1;
+                            }
+                        }
+                        break;
+                    case Kind::Run:
+                        for (std::size_t run{0}; run < runCount(); ++run) {
+                            const Value start(values[2 * run]);
+                            for (Value low{start}; low <= start + values[2 * run + 1]; ++low) mFunction(high | low);
+                        }
+                        break;
+                }
+            }
+
+            /**
+             * Copie du contenu sous forme de bitmap (BitmapWords mots)
+             */
+            [[nodiscard]] auto toWords() const -> std::vector<std::uint64_t> {
+                if (kind == Kind::Bitmap) return words;
+
+                std::vector<std::uint64_t> result(BitmapWords, 0);
+                forEach([&result](const Value value) {
+                    const auto low(value & 0xFFFF);
+                    result[low / 64] |= std::uint64_t{1} << (low % 64);
+                });
+                return result;
+            }
+
+            /**
+             * Conteneur tableau ou bitmap selon la cardinalité, à partir d'un bitmap
+             */
+            auto assignWords(std::vector<std::uint64_t> bitmap) -> void {
+                cardinality = 0;
+                for (const auto word: bitmap) cardinality += static_cast<std::uint32_t>(std::popcount(word));
+
+                values.clear();
+                if (cardinality > ArrayMax) {
+                    kind = Kind::Bitmap;
+                    words = std::move(bitmap);
+                    values.shrink_to_fit();
+                    return;
+                }
+
+                kind = Kind::Array;
+                values.reserve(cardinality);
+                for (std::size_t word_index{0}; word_index < BitmapWords; ++word_index) {
+                    auto word(bitmap[word_index]);
+                    while (word != 0) {
+                        values.push_back(static_cast<std::uint16_t>(word_index * 64 + static_cast<std::size_t>(std::countr_zero(word))));
+                        word &= word - 1;
+                    }
+                }
+                words.clear();
+                words.shrink_to_fit();
+            }
+
+            /**
+             * Reconvertit un conteneur de plages en tableau ou bitmap avant une modification
+             */
+            auto expandRuns() -> void {
+                if (kind == Kind::Run) assignWords(toWords());
+            }
+
+            auto add(const std::uint16_t low) -> bool {
+                expandRuns();
+
+                if (kind == Kind::Bitmap) {
+                    auto &word(words[low / 64]);
+                    const auto bit(std::uint64_t{1} << (low % 64));
+                    if (word & bit) return false;
+                    word |= bit;
+                    ++cardinality;
+                    return true;
+                }
+
+                const auto it(std::lower_bound(values.begin(), values.end(), low));
+                if (it != values.end() && *it == low) return false;
+
+                if (values.size() < ArrayMax) {
+                    values.insert(it, low);
+                    ++cardinality;
+                    return true;
+                }
+
+                auto bitmap(toWords());
+                bitmap[low / 64] |= std::uint64_t{1} << (low % 64);
+                assignWords(std::move(bitmap));
+                return true;
+            }
+
+            auto remove(const std::uint16_t low) -> bool {
+                if (!contains(low)) return false;
+                expandRuns();
+
+                if (kind == Kind::Array) {
+                    values.erase(std::lower_bound(values.begin(), values.end(), low));
+                    --cardinality;
+                    return true;
+                }
+
+                words[low / 64] &= ~(std::uint64_t{1} << (low % 64));
+                // Retour au tableau avec une marge : des ajouts et retraits alternés autour de
+                // ArrayMax ne reconvertissent pas le conteneur à chaque fois
+                if (--cardinality < ArrayMax / 2) assignWords(std::move(words));
+                return true;
+            }
+
+            /**
+             * Retire les valeurs supérieures ou égales à low
+             *
+             * @return Nombre de valeurs retirées
+             */
+            auto truncate(const std::uint16_t low) -> std::uint32_t {
+                expandRuns();
+
+                const auto before(cardinality);
+                if (kind == Kind::Array) {
+                    values.erase(std::lower_bound(values.begin(), values.end(), low), values.end());
+                    cardinality = static_cast<std::uint32_t>(values.size());
+                } else {
+                    words[low / 64] &= (std::uint64_t{1} << (low % 64)) - 1;
+                    std::fill(words.begin() + low / 64 + 1, words.end(), 0);
+                    assignWords(std::move(words));
+                }
+                return before - cardinality;
+            }
+
+            /**
+             * Passe en conteneur de plages si c'est plus compact
+             */
+            auto optimize() -> void {
+                std::vector<std::uint16_t> runs;
+                std::uint32_t previous{0x10000}, start{0};
+                const auto push([&runs, &start, &previous]() {
+                    runs.push_back(static_cast<std::uint16_t>(start));
+                    runs.push_back(static_cast<std::uint16_t>(previous - start));
+                });
+                forEach([&](const Value value) {
+                    const auto low(value & 0xFFFF);
+                    if (previous == 0x10000 || low != previous + 1) {
+                        if (previous != 0x10000) push();
+                        start = low;
+                    }
+                    previous = low;
+                });
+                if (previous != 0x10000) push();
+
+                const auto current_bytes(kind == Kind::Bitmap ? BitmapWords * sizeof(std::uint64_t)
+                                                               : values.size() * sizeof(std::uint16_t));
+                if (runs.size() * sizeof(std::uint16_t) >= current_bytes) return;
+
+                kind = Kind::Run;
+                values = std::move(runs);
+                words.clear();
+                words.shrink_to_fit();
+            }
+
+            [[nodiscard]] auto allocatedBytes() const noexcept -> std::size_t {
+                return values.capacity() * sizeof(std::uint16_t) + words.capacity() * sizeof(std::uint64_t);
+            }
+        };
+
+        // Conteneurs triés par clé (16 bits de poids fort)
+        std::vector<Container> containers;
+        std::size_t count{0};
+
+        [[nodiscard]] auto findContainer(const std::uint16_t key) const noexcept -> std::vector<Container>::const_iterator {
+            return std::lower_bound(containers.begin(), containers.end(), key,
+                                    [](const Container &container, const std::uint16_t k) { return container.key < k; });
+        }
+
+        [[nodiscard]] auto findContainer(const std::uint16_t key) noexcept -> std::vector<Container>::iterator {
+            return std::lower_bound(containers.begin(), containers.end(), key,
+                                    [](const Container &container, const std::uint16_t k) { return container.key < k; });
+        }
+
+        static constexpr auto highOf(const Value value) noexcept -> std::uint16_t {
+            return static_cast<std::uint16_t>(value >> 16);
+        }
+
+        static constexpr auto lowOf(const Value value) noexcept -> std::uint16_t {
+            return static_cast<std::uint16_t>(value & 0xFFFF);
+        }
+
+        /**
+         * Intersection de deux conteneurs de même clé : un tableau est filtré par l'autre
+         * conteneur, les autres cas passent par des bitmaps
+         */
+        static auto intersectContainers(const Container &a, const Container &b) -> Container {
+            Container result;
+            result.key = a.key;
+
+            if (a.kind == Kind::Array || b.kind == Kind::Array) {
+                const auto &array(a.kind == Kind::Array ? a : b);
+                const auto &other(a.kind == Kind::Array ? b : a);
+                for (const auto low: array.values) {
+                    if (other.contains(low)) result.values.push_back(low);
+                }
+                result.cardinality = static_cast<std::uint32_t>(result.values.size());
+                return result;
+            }
+
+            auto bitmap(a.toWords());
+            const auto other(b.toWords());
+            for (std::size_t word_index{0}; word_index < BitmapWords; ++word_index) bitmap[word_index] &= other[word_index];
+            result.assignWords(std::move(bitmap));
+            return result;
+        }
+
+        /**
+         * Union de deux conteneurs de même clé : fusion de deux tableaux, bitmap sinon
+         */
+        static auto uniteContainers(const Container &a, const Container &b) -> Container {
+            Container result;
+            result.key = a.key;
+
+            if (a.kind == Kind::Array && b.kind == Kind::Array && a.values.size() + b.values.size() <= ArrayMax) {
+                result.values.reserve(a.values.size() + b.values.size());
+                std::ranges::set_union(a.values, b.values, std::back_inserter(result.values));
+                result.cardinality = static_cast<std::uint32_t>(result.values.size());
+                return result;
+            }
+
+            auto bitmap(a.toWords());
+            b.forEach([&bitmap](const Value value) {
+                const auto low(lowOf(value));
+                bitmap[low / 64] |= std::uint64_t{1} << (low % 64);
+            });
+            result.assignWords(std::move(bitmap));
+            return result;
+        }
+
+    public:
+        /**
+         * Ajoute une valeur
+         *
+         * @return true si la valeur était absente
+         */
+        auto add(const Value value) -> bool {
+            auto it(findContainer(highOf(value)));
+            if (it == containers.end() || it->key != highOf(value)) {
+                it = containers.insert(it, Container{});
+                it->key = highOf(value);
+            }
+
+            if (!it->add(lowOf(value))) return false;
+            ++count;
+            return true;
+        }
+
+        /**
+         * Retire une valeur
+         *
+         * @return true si la valeur était présente
+         */
+        auto remove(const Value value) -> bool {
+            const auto it(findContainer(highOf(value)));
+            if (it == containers.end() || it->key != highOf(value) || !it->remove(lowOf(value))) return false;
+
+            if (it->cardinality == 0) containers.erase(it);
+            --count;
+            return true;
+        }
+
+        /**
+         * Retire toutes les valeurs supérieures ou égales à from
+         */
+        auto removeFrom(const Value from) -> void {
+            auto it(findContainer(highOf(from)));
+            if (it != containers.end() && it->key == highOf(from)) {
+                count -= it->truncate(lowOf(from));
+                if (it->cardinality > 0) ++it;
+            }
+            for (auto removed(it); removed != containers.end(); ++removed) count -= removed->cardinality;
+            containers.erase(it, containers.end());
+        }
+
+        [[nodiscard]] auto contains(const Value value) const noexcept -> bool {
+            const auto it(findContainer(highOf(value)));
+            return it != containers.end() && it->key == highOf(value) && it->contains(lowOf(value));
+        }
+
+        /**
+         * Nombre de valeurs de l'ensemble
+         */
+        [[nodiscard]] auto cardinality() const noexcept -> std::size_t {
+            return count;
+        }
+
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return count == 0;
+        }
+
+        auto clear() noexcept -> void {
+            containers.clear();
+            count = 0;
+        }
+
+        /**
+         * Plus petite valeur de l'ensemble supérieure ou égale à from.
+         *
+         * Chaque appel recherche à nouveau le conteneur : un parcours par nextFrom reste valide
+         * si l'ensemble est modifié entre deux appels, contrairement à forEach.
+         */
+        [[nodiscard]] auto nextFrom(const Value from) const noexcept -> std::optional<Value> {
+            for (auto it(findContainer(highOf(from))); it != containers.end(); ++it) {
+                const auto low(it->key == highOf(from) ? std::uint32_t{lowOf(from)} : std::uint32_t{0});
+                if (const auto next = it->nextFrom(low)) return (static_cast<Value>(it->key) << 16) | *next;
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * Applique une fonction sur toutes les valeurs, dans l'ordre croissant. L'ensemble ne
+         * doit pas être modifié pendant le parcours.
+         *
+         * @tparam TF Type de la fonction à appliquer (void mFunction(Value value))
+         */
+        template<typename TF>
+        auto forEach(TF &&mFunction) const -> void {
+            for (const auto &container: containers) container.forEach(mFunction);
+        }
+
+        /**
+         * Convertit en plages les conteneurs pour lesquels c'est plus compact (valeurs
+         * consécutives). Une modification ultérieure d'un tel conteneur le reconvertit.
+         */
+        auto optimize() -> void {
+            for (auto &container: containers) container.optimize();
+        }
+
+        /**
+         * Intersection de deux ensembles
+         */
+        [[nodiscard]] static auto intersect(const RoaringBitmap &a, const RoaringBitmap &b) -> RoaringBitmap {
+            RoaringBitmap result;
+            auto it_a(a.containers.begin());
+            auto it_b(b.containers.begin());
+            while (it_a != a.containers.end() && it_b != b.containers.end()) {
+                if (it_a->key < it_b->key) {
+                    ++it_a;
+                } else if (it_b->key < it_a->key) {
+                    ++it_b;
+                } else {
+                    auto container(intersectContainers(*it_a, *it_b));
+                    if (container.cardinality > 0) {
+                        result.count += container.cardinality;
+                        result.containers.push_back(std::move(container));
+                    }
+                    ++it_a;
+                    ++it_b;
+                }
+            }
+            return result;
+        }
+
+        /**
+         * Union de deux ensembles
+         */
+        [[nodiscard]] static auto unite(const RoaringBitmap &a, const RoaringBitmap &b) -> RoaringBitmap {
+            RoaringBitmap result;
+            auto it_a(a.containers.begin());
+            auto it_b(b.containers.begin());
+            while (it_a != a.containers.end() || it_b != b.containers.end()) {
+                if (it_b == b.containers.end() || (it_a != a.containers.end() && it_a->key < it_b->key)) {
+                    result.containers.push_back(*it_a++);
+                } else if (it_a == a.containers.end() || it_b->key < it_a->key) {
+                    result.containers.push_back(*it_b++);
+                } else {
+                    result.containers.push_back(uniteContainers(*it_a++, *it_b++));
+                }
+                result.count += result.containers.back().cardinality;
+            }
+            return result;
+        }
+
+        /**
+         * Mémoire allouée (octets), conteneurs compris
+         */
+        [[nodiscard]] auto allocatedBytes() const noexcept -> std::size_t {
+            auto bytes(containers.capacity() * sizeof(Container));
+            for (const auto &container: containers) bytes += container.allocatedBytes();
+            return bytes;
+        }
+    };
+
+}
+
+#endif //ECS_TOOLS_ROARING_BITMAP_H
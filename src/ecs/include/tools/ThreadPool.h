@@ -0,0 +1,140 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_TOOLS_THREAD_POOL_H
+#define ECS_TOOLS_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ecs::tools {
+
+    /**
+     * Pool de threads de taille fixe, partagé par plusieurs mondes (Managers) pour les faire
+     * avancer en parallèle.
+     *
+     * Un seul parallelFor peut être en cours à la fois ; le thread appelant participe au
+     * travail puis attend la fin de toutes les itérations. Les itérations sont distribuées une
+     * par une (compteur atomique), ce qui équilibre des mondes de tailles différentes.
+     */
+    class ThreadPool {
+        std::vector<std::jthread> workers_;
+
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::condition_variable done_;
+
+        // Travail en cours (protégé par mutex_, sauf next_)
+        const std::function<void(std::size_t)> *job_{nullptr};
+        std::size_t count_{0};
+        // Threads ayant pris le travail en cours et pas encore sortis de work()
+        std::size_t active_{0};
+        std::atomic<std::size_t> next_{0};
+        std::size_t generation_{0};
+        bool stopping_{false};
+
+        /**
+         * Exécute des itérations du travail en cours jusqu'à épuisement
+         */
+        auto work(const std::function<void(std::size_t)> &job, const std::size_t count) -> void {
+            for (auto index(next_.fetch_add(1)); index < count; index = next_.fetch_add(1)) {
+                job(index);
+            }
+        }
+
+        auto workerLoop() -> void {
+            std::size_t seen_generation{0};
+            while (true) {
+                const std::function<void(std::size_t)> *job;
+                std::size_t count;
+                {
+                    std::unique_lock lock(mutex_);
+                    wake_.wait(lock, [this, seen_generation] { return stopping_ || generation_ != seen_generation; });
+                    if (stopping_) return;
+
+                    seen_generation = generation_;
+                    // Réveil tardif : le travail est déjà terminé
+                    if (job_ == nullptr) continue;
+
+                    job = job_;
+                    count = count_;
+                    ++active_;
+                }
+
+                work(*job, count);
+
+                {
+                    std::lock_guard lock(mutex_);
+                    --active_;
+                }
+                done_.notify_all();
+            }
+        }
+
+    public:
+        /**
+         * @param thread_count Nombre de threads de travail (en plus du thread appelant)
+         */
+        explicit ThreadPool(const std::size_t thread_count = std::max(1u, std::thread::hardware_concurrency()) - 1) {
+            workers_.reserve(thread_count);
+            for (std::size_t i{0}; i < thread_count; ++i) {
+                workers_.emplace_back([this] { workerLoop(); });
+            }
+        }
+
+        ~ThreadPool() {
+            {
+                std::lock_guard lock(mutex_);
+                stopping_ = true;
+            }
+            wake_.notify_all();
+        }
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        /**
+         * Nombre de threads de travail (hors thread appelant)
+         */
+        [[nodiscard]] auto size() const noexcept -> std::size_t {
+            return workers_.size();
+        }
+
+        /**
+         * Appelle job(i) pour chaque i de [0, count), en parallèle, et attend la fin.
+         * job ne doit pas lever d'exception ni rappeler parallelFor.
+         *
+         * @param count Nombre d'itérations
+         * @param job Fonction void(std::size_t index)
+         */
+        auto parallelFor(const std::size_t count, const std::function<void(std::size_t)> &job) -> void {
+            if (count == 0) return;
+
+            {
+                std::lock_guard lock(mutex_);
+                job_ = &job;
+                count_ = count;
+                next_ = 0;
+                ++generation_;
+            }
+            wake_.notify_all();
+
+            work(job, count);
+
+            // Attente des itérations en cours dans les autres threads
+            std::unique_lock lock(mutex_);
+            done_.wait(lock, [this] { return active_ == 0; });
+            job_ = nullptr;
+        }
+    };
+
+}
+
+#endif //ECS_TOOLS_THREAD_POOL_H
@@ -5,7 +5,11 @@
 #ifndef ECS_TOOLS_TYPES_LIST_H
 #define ECS_TOOLS_TYPES_LIST_H
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <type_traits>
+#include <utility>
 
 namespace ecs::tools {
 
@@ -43,9 +47,9 @@ namespace ecs::tools {
 
     // Template permettant d'identifier si un type T est présent dans une liste de type Ts
     // Le principe est d'appliquer le test std::is_same<> sur tous les couples de type
-    // et d'appliquer un 'or' sur toutes les valeurs trouvé
+    // et d'appliquer un 'or' sur toutes les valeurs trouvé (fold expression : pas de récursion)
     template<typename T, typename... Ts>
-    struct contains<T, TypeList<Ts...> > : std::disjunction<std::is_same<T, Ts>...> {
+    struct contains<T, TypeList<Ts...> > : std::bool_constant<(std::is_same_v<T, Ts> || ...)> {
     };
 
     template<typename T, typename... Ts>
@@ -89,41 +93,27 @@ namespace ecs::tools {
     // /
     // / Cette section est pour déterminer l'indice du type T dans un TypeList
     // /
-    template<typename T, typename... Ts>
-    struct index_of;
-
-    template<typename T>
-    struct index_of<T> : std::integral_constant<std::int32_t, -1> {
-    };
-
-    // Spécialisation pour TypeList : on recherche T dans les éléments Ts...
-    template<typename T, typename... Ts>
-    struct index_of<T, TypeList<Ts...>> {
-    private:
-        template<typename U, typename First, typename... Rest>
-        static constexpr std::int32_t find_index() {
-            if constexpr (std::is_same_v<U, First>) {
-                return 0;
-            } else if constexpr (sizeof...(Rest) == 0) {
-                return -1;
-            } else {
-                constexpr auto rest_index = find_index<U, Rest...>();
-                return rest_index == -1 ? -1 : rest_index + 1;
+    namespace impl {
+        // Indice du premier true du tableau (-1 si aucun), calculé par une boucle constexpr
+        template<std::size_t N>
+        constexpr auto first_match(const std::array<bool, N> &matches) noexcept -> std::int32_t {
+            for (std::size_t i{0}; i < N; ++i) {
+                if (matches[i]) return static_cast<std::int32_t>(i);
             }
+            return -1;
         }
+    }
 
-    public:
-        static constexpr std::int32_t value = find_index<T, Ts...>();
+    // Recherche de T parmi les types Ts... (-1 si absent)
+    template<typename T, typename... Ts>
+    struct index_of : std::integral_constant<std::int32_t,
+                impl::first_match(std::array<bool, sizeof...(Ts)>{std::is_same_v<T, Ts>...})> {
     };
 
-    // Spécialisation récursive pour la recherche dans une liste de types
-    template<typename T, typename U, typename... Us>
-    struct index_of<T, U, Us...> {
-        static constexpr std::int32_t value = std::is_same_v<T, U>
-                                              ? 0
-                                              : index_of<T, Us...>::value != -1
-                                                    ? index_of<T, Us...>::value + 1
-                                                    : -1;
+    // Spécialisation pour TypeList : on recherche T dans les éléments Ts...
+    template<typename T, typename... Ts>
+    struct index_of<T, TypeList<Ts...>> : std::integral_constant<std::int32_t,
+                impl::first_match(std::array<bool, sizeof...(Ts)>{std::is_same_v<T, Ts>...})> {
     };
 
     // /////////////////////////////////////////////////////////////////////////////////
@@ -151,17 +141,23 @@ namespace ecs::tools {
     // /
     // / Equivalent de MPL::Repeat
     // /
-    template<int N, typename T, typename SeqWithArgs>
-    struct repeat;
+    namespace impl {
+        // Ignore l'indice I : permet de répéter T en dépliant une std::index_sequence
+        template<std::size_t I, typename T>
+        using ignore_index = T;
 
-    template<typename T, template<typename...> class Seq, typename... Args>
-    struct repeat<0, T, Seq<Args...> > {
-        using type = Seq<Args...>;
-    };
+        template<typename Indexes, typename T, typename SeqWithArgs>
+        struct repeat;
+
+        template<std::size_t... Is, typename T, template<typename...> class Seq, typename... Args>
+        struct repeat<std::index_sequence<Is...>, T, Seq<Args...> > {
+            using type = Seq<ignore_index<Is, T>..., Args...>;
+        };
+    }
 
-    template<int N, typename T, template <typename...> class Seq, typename... Args>
-    struct repeat<N, T, Seq<Args...> > {
-        using type = typename repeat<N - 1, T, Seq<T, Args...> >::type;
+    // Ajoute N fois T en tête de Seq<Args...>
+    template<int N, typename T, typename SeqWithArgs>
+    struct repeat : impl::repeat<std::make_index_sequence<static_cast<std::size_t>(N)>, T, SeqWithArgs> {
     };
 
     // /////////////////////////////////////////////////////////////////////////////////
@@ -169,39 +165,123 @@ namespace ecs::tools {
     // / Equivalent de MPL::Filter
     // /
 
-    template<typename List1, typename List2>
-    struct concat;
+    namespace impl {
+        // Concaténation par fold expression sur un opérateur : aucune instanciation récursive
+        template<typename... Ts>
+        struct join {
+            using type = TypeList<Ts...>;
+        };
+
+        // Déclaration seule : n'est utilisé que dans decltype
+        template<typename... Ts, typename... Us>
+        auto operator+(join<Ts...>, join<Us...>) -> join<Ts..., Us...>;
+
+        template<typename List>
+        struct as_join;
+
+        template<typename... Ts>
+        struct as_join<TypeList<Ts...>> {
+            using type = join<Ts...>;
+        };
+    }
 
-    template<typename... T1, typename... T2>
-    struct concat<TypeList<T1...>, TypeList<T2...>> {
-        using type = TypeList<T1..., T2...>;
+    // Concaténation de TypeList : concat<TypeList<A, B>, TypeList<C>, ...>::type == TypeList<A, B, C, ...>
+    template<typename... Lists>
+    struct concat {
+        using type = typename decltype((impl::join<>{} + ... + typename impl::as_join<Lists>::type{}))::type;
     };
 
+    template<typename... Lists>
+    using concat_t = typename concat<Lists...>::type;
+
     template<typename Tuple, template<typename> typename Predicate>
     struct filter;
 
-    template<template<typename> typename Predicate>
-    struct filter<TypeList<>, Predicate> {
-        using type = TypeList<>;
-    };
-
-    // Spécialisation récursive pour TypeList non-vide
-    template<typename Head, typename... Tail, template<typename> typename Predicate>
-    struct filter<TypeList<Head, Tail...>, Predicate> {
-        using type = std::conditional_t<
-            Predicate<Head>::value,
-            typename concat<
-                TypeList<Head>,
-                typename filter<TypeList<Tail...>, Predicate>::type
-            >::type,
-            typename filter<TypeList<Tail...>, Predicate>::type
-        >;
+    // Chaque type est remplacé par une liste d'un élément (conservé) ou vide (filtré), puis tout est concaténé
+    template<typename... Ts, template<typename> typename Predicate>
+    struct filter<TypeList<Ts...>, Predicate> {
+        using type = typename decltype((impl::join<>{} + ... +
+                                        std::conditional_t<Predicate<Ts>::value, impl::join<Ts>, impl::join<>>{}))::type;
     };
 
     // Alias pour faciliter l'utilisation
     template<typename Sequence, template<typename> typename Predicate>
     using filter_t = typename filter<Sequence, Predicate>::type;
 
+    // /////////////////////////////////////////////////////////////////////////////////
+    // /
+    // / Equivalent de MPL::At : récupère le N-ième type d'un TypeList
+    // /
+    template<std::size_t N, typename Sequence>
+    struct at;
+
+    namespace impl {
+        template<std::size_t I, typename T>
+        struct indexed {
+            using type = T;
+        };
+
+        // Hérite de indexed<0, T0>, indexed<1, T1>, ... : le N-ième type est retrouvé par
+        // résolution de surcharge (conversion vers la base indexed<N, T>) au lieu d'une récursion
+        template<typename Indexes, typename... Ts>
+        struct indexed_list;
+
+        template<std::size_t... Is, typename... Ts>
+        struct indexed_list<std::index_sequence<Is...>, Ts...> : indexed<Is, Ts>... {
+        };
+
+        template<std::size_t N, typename T>
+        auto select(const indexed<N, T> &) -> indexed<N, T>;
+    }
+
+    template<std::size_t N, typename... Ts>
+    struct at<N, TypeList<Ts...>> {
+        static_assert(N < sizeof...(Ts), "Index out of TypeList bounds");
+        using type = typename decltype(impl::select<N>(
+            std::declval<impl::indexed_list<std::index_sequence_for<Ts...>, Ts...>>()))::type;
+    };
+
+    template<std::size_t N, typename Sequence>
+    using at_t = typename at<N, Sequence>::type;
+
+    // /////////////////////////////////////////////////////////////////////////////////
+    // /
+    // / Cette section permet de vérifier si deux TypeList ont au moins un type en commun
+    // /
+    template<typename List1, typename List2>
+    struct intersects;
+
+    template<typename... T1, typename List2>
+    struct intersects<TypeList<T1...>, List2> : std::bool_constant<(contains<T1, List2>::value || ...)> {
+    };
+
+    template<typename List1, typename List2>
+    constexpr bool intersects_v = intersects<List1, List2>::value;
+
+    // Exemple d'usage :
+    // /
+    // / intersects_v<TypeList<CTransform, CShape>, TypeList<CShape>> == true
+    // / intersects_v<TypeList<CTransform>, TypeList<CShape>> == false
+
+    // /////////////////////////////////////////////////////////////////////////////////
+    // /
+    // / Cette section permet de vérifier si tous les types d'une TypeList sont présents dans une autre
+    // /
+    template<typename List1, typename List2>
+    struct includes;
+
+    template<typename... T1, typename List2>
+    struct includes<TypeList<T1...>, List2> : std::bool_constant<(contains<T1, List2>::value && ...)> {
+    };
+
+    template<typename List1, typename List2>
+    constexpr bool includes_v = includes<List1, List2>::value;
+
+    // Exemple d'usage :
+    // /
+    // / includes_v<TypeList<CShape>, TypeList<CTransform, CShape>> == true
+    // / includes_v<TypeList<CTransform, CShape>, TypeList<CShape>> == false
+
 }
 
 #endif //ECS_TOOLS_TYPES_LIST_H
@@ -0,0 +1,44 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef ECS_TOOLS_TYPE_NAME_H
+#define ECS_TOOLS_TYPE_NAME_H
+
+#include <string_view>
+
+namespace ecs::tools {
+
+    /**
+     * Nom lisible d'un type, calculé à la compilation (pour l'affichage et le debug uniquement :
+     * le format dépend du compilateur).
+     *
+     * @tparam T Type dont on veut le nom
+     * @return Nom du type (ex. "CTransform", "ecs::CHierarchy")
+     */
+    template<typename T>
+    constexpr auto type_name() noexcept -> std::string_view {
+#if defined(__clang__) || defined(__GNUC__)
+        constexpr std::string_view function{__PRETTY_FUNCTION__};
+        constexpr std::string_view prefix{"T = "};
+        constexpr auto first(function.find(prefix) + prefix.size());
+        constexpr auto last(function.find_first_of(";]", first));
+        return function.substr(first, last - first);
+#elif defined(_MSC_VER)
+        constexpr std::string_view function{__FUNCSIG__};
+        constexpr std::string_view prefix{"type_name<"};
+        constexpr auto first(function.find(prefix) + prefix.size());
+        constexpr auto last(function.rfind(">(void)"));
+        auto name(function.substr(first, last - first));
+        for (const std::string_view keyword: {"struct ", "class "}) {
+            if (name.starts_with(keyword)) name.remove_prefix(keyword.size());
+        }
+        return name;
+#else
+        return "unknown";
+#endif
+    }
+
+}
+
+#endif //ECS_TOOLS_TYPE_NAME_H
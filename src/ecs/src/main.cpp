@@ -2,9 +2,17 @@
 // Created by Zéro Cool on 06/07/2025.
 //
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <ranges>
+#include <string>
 
 #include "Ecs.h"
+#include "tools/ThreadPool.h"
 
 
 // Components :
@@ -24,6 +32,37 @@ struct CPosition {
     int value;
 };
 
+// Composant non trivialement copiable : sérialisé dans les snapshots par son codec
+struct CName {
+    std::string value;
+
+    auto operator==(const CName &) const -> bool = default;
+};
+
+// Valeur partagée par de nombreuses entités (ecs::Shared<CStyle>)
+struct CStyle {
+    int color;
+    float radius;
+
+    auto operator==(const CStyle &) const -> bool = default;
+};
+
+template<>
+struct ecs::SnapshotCodec<CName> {
+    static void write(SnapshotWriter &writer, const CName &name) {
+        writer.write(name.value.size());
+        writer.writeBytes(name.value.data(), name.value.size());
+    }
+
+    static void read(SnapshotReader &reader, CName &name) {
+        std::size_t length{0};
+        if (!reader.read(length)) return;
+        if (const auto *data = reader.take(length)) {
+            name.value.assign(reinterpret_cast<const char *>(data), length);
+        }
+    }
+};
+
 // ComponentList :
 //   Compile-time list of component types.
 
@@ -65,6 +104,46 @@ using S3 = ecs::Signature<CVelocity, Tag0, CPosition, Tag1>;
 
 using MySignatureList = ecs::SignatureList<S0, S1, S2, S3>;
 
+// System
+//   Compile-time declaration of the components read and written by a system.
+
+struct SysA : ecs::System<ecs::Reads<CPosition>, ecs::Writes<CTransform>> {
+};
+struct SysB : ecs::System<ecs::Reads<CTransform>> {
+};
+struct SysC : ecs::System<ecs::Reads<CPosition>> {
+};
+struct SysD : ecs::System<ecs::Reads<>, ecs::Writes<CPosition>> {
+};
+// Crée et tue des entités : exclusif
+struct SysSpawn : ecs::System<ecs::Reads<>, ecs::Writes<ecs::Entities>> {
+};
+
+// SystemList
+//   Compile-time list of system types.
+
+using MySystemList = ecs::SystemList<SysA, SysB, SysC, SysD>;
+
+// Resource
+//   Unique, world-level data (not attached to any entity).
+
+struct RClock {
+    int frame{0};
+};
+
+struct RScore {
+    int value{0};
+};
+
+using MyResourceList = ecs::ResourceList<RClock, RScore>;
+
+struct SysClock : ecs::System<ecs::Reads<>, ecs::Writes<RClock>> {
+};
+struct SysScore : ecs::System<ecs::Reads<RClock>, ecs::Writes<RScore>> {
+};
+struct SysHud : ecs::System<ecs::Reads<RScore, CPosition>> {
+};
+
 
 template<typename... Ts>
 using TupleOfVectors = std::tuple<std::vector<Ts>...>;
@@ -89,6 +168,40 @@ void func() {
 template<typename T>
 using IsIntegral = std::is_integral<T>;
 
+// Broadphase de test : ne propose que les couples dont la seconde entité a un index pair
+struct EvenBroadphase {
+    template<typename TManager, typename TEmit>
+    auto forEachCandidate(TManager &, std::span<const ecs::EntityIndex> entities_a,
+                          std::span<const ecs::EntityIndex> entities_b, TEmit &&emit) const -> void {
+        for (const auto a: entities_a) {
+            for (const auto b: entities_b) {
+                if (b.get() % 2 == 0) emit(a, b);
+            }
+        }
+    }
+};
+
+// Observateur de test : compte les notifications reçues
+struct EventLog {
+    std::size_t added{0}, removed{0}, tagged{0}, killed{0};
+    int last_killed_value{-1};
+
+    template<typename TManager>
+    void onAdded(TManager &, ecs::EntityIndex) { ++added; }
+
+    template<typename TManager>
+    void onRemoved(TManager &, ecs::EntityIndex) { ++removed; }
+
+    template<typename TManager>
+    void onTagged(TManager &, ecs::EntityIndex) { ++tagged; }
+
+    template<typename TManager>
+    void onKilled(TManager &manager, const ecs::EntityIndex entity_index) {
+        ++killed;
+        last_killed_value = manager.template getComponent<CPosition>(entity_index).value;
+    }
+};
+
 
 template<typename T>
 class test_for {
@@ -274,24 +387,14 @@ int main() {
     static_assert(std::is_same_v<std::bitset<5>, MySettings::Bitset>, "");
     static_assert(std::is_same_v<std::bitset<5>, MySettings::SignatureBitsets::Bitset>, "");
 
-    // Le tuple doit contenir autant de MySettings::Bitset que de signature dans les Settings
+    // Le tableau doit contenir autant de MySettings::Bitset que de signature dans les Settings
     static_assert(std::is_same_v<
-                      std::tuple<
-                          std::bitset<5>,
-                          std::bitset<5>,
-                          std::bitset<5>,
-                          std::bitset<5>
-                      >,
+                      std::array<std::bitset<5>, 4>,
                       MySettings::SignatureBitsets::BitsetStorage>, "");
 
-    // Le tuple doit contenir autant de MySettings::Bitset que de signature dans les Settings
+    // Le tableau doit contenir autant de MySettings::Bitset que de signature dans les Settings
     static_assert(std::is_same_v<
-                      std::tuple<
-                          MySettings::Bitset,
-                          MySettings::Bitset,
-                          MySettings::Bitset,
-                          MySettings::Bitset
-                      >,
+                      std::array<MySettings::Bitset, 4>,
                       MySettings::SignatureBitsets::BitsetStorage>, "");
 
     static_assert(MySettings::SignatureBitsets::IsComponentFilter<CTransform>::value, "");
@@ -371,6 +474,13 @@ int main() {
     >);
 
 
+    // tools::concat (nombre quelconque de listes) et tools::at
+    static_assert(std::is_same_v<
+        ecs::tools::concat_t<ecs::tools::TypeList<int>, ecs::tools::TypeList<>, ecs::tools::TypeList<char, bool> >,
+        ecs::tools::TypeList<int, char, bool>
+    >);
+    static_assert(std::is_same_v<ecs::tools::at_t<3, MyList>, bool>);
+
     using test_index_of = ecs::tools::TypeList<CTransform, CVelocity, CPosition, int, ecs::Signature<CTransform> >;
 
     static_assert(ecs::tools::index_of<CTransform, test_index_of>::value == 0);
@@ -447,9 +557,77 @@ int main() {
     using BitsetStorage = SignatureBitsets::BitsetStorage;
 
     static_assert(
-        std::is_same_v<BitsetStorage, std::tuple<std::bitset<5>, std::bitset<5>, std::bitset<5>, std::bitset<5> > >,
+        std::is_same_v<BitsetStorage, std::array<std::bitset<5>, 4> >,
         "");
 
+    //
+    // Check SystemSchedule structure
+    //
+    using MySystemSettings = ecs::Settings<MyComponentsList, MyTagList, MySignatureList, MySystemList>;
+    using MySchedule = MySystemSettings::SystemSchedule;
+
+    static_assert(std::is_same_v<MySettings::SystemList, ecs::tools::TypeList<> >);
+    static_assert(MySettings::SystemSchedule::stageCount() == 0);
+    static_assert(MySystemSettings::systemCount() == 4);
+    static_assert(MySystemSettings::isSystem<SysC>());
+    static_assert(!MySystemSettings::isSystem<CTransform>());
+    static_assert(MySystemSettings::systemID<SysD>() == 3);
+
+    static_assert(MySchedule::conflicts<SysA, SysB>());
+    static_assert(MySchedule::conflicts<SysA, SysD>());
+    static_assert(!MySchedule::conflicts<SysA, SysC>());
+    static_assert(!MySchedule::conflicts<SysB, SysC>());
+    static_assert(!MySchedule::conflicts<SysB, SysB>());
+
+    static_assert(MySchedule::stageCount() == 2);
+    static_assert(MySchedule::stageOf<SysA>() == 0);
+    static_assert(MySchedule::stageOf<SysB>() == 1);
+    static_assert(MySchedule::stageOf<SysC>() == 0);
+    static_assert(MySchedule::stageOf<SysD>() == 1);
+    static_assert(MySchedule::isSameStage<SysA, SysC>());
+    static_assert(std::is_same_v<MySchedule::StageSystems<0>, ecs::tools::TypeList<SysA, SysC> >);
+    static_assert(std::is_same_v<MySchedule::StageSystems<1>, ecs::tools::TypeList<SysB, SysD> >);
+
+    std::string system_order;
+    MySchedule::forEachSystem([&system_order]<typename TSystem>() {
+        system_order += static_cast<char>('A' + MySystemSettings::systemID<TSystem>());
+    });
+    assert(system_order == "ACBD");
+    std::cout << "System order : " << system_order << std::endl;
+
+    // Un système structurel est en conflit avec tous les autres, même sans composant commun
+    using MyStructuralSchedule = ecs::Settings<MyComponentsList, MyTagList, MySignatureList,
+        ecs::SystemList<SysB, SysSpawn, SysC>>::SystemSchedule;
+    static_assert(MyStructuralSchedule::isStructural<SysSpawn>() && !MyStructuralSchedule::isStructural<SysA>());
+    static_assert(MyStructuralSchedule::conflicts<SysSpawn, SysC>() && MyStructuralSchedule::conflicts<SysB, SysSpawn>());
+    static_assert(MyStructuralSchedule::stageOf<SysB>() == 0);
+    static_assert(MyStructuralSchedule::stageOf<SysSpawn>() == 1);
+    static_assert(MyStructuralSchedule::stageOf<SysC>() == 2);
+
+    //
+    // Check resources
+    //
+    using MyResourceSettings = ecs::Settings<MyComponentsList, MyTagList, MySignatureList,
+        ecs::SystemList<SysClock, SysHud, SysScore>, MyResourceList>;
+    using MyResourceSchedule = MyResourceSettings::SystemSchedule;
+
+    static_assert(MyResourceSettings::resourceCount() == 2);
+    static_assert(MyResourceSettings::isResource<RScore>());
+    static_assert(!MyResourceSettings::isResource<CPosition>());
+    static_assert(MySettings::resourceCount() == 0);
+    static_assert(MyResourceSchedule::conflicts<SysClock, SysScore>());
+    static_assert(!MyResourceSchedule::conflicts<SysClock, SysHud>());
+    static_assert(MyResourceSchedule::isSameStage<SysClock, SysHud>());
+    static_assert(MyResourceSchedule::stageOf<SysScore>() == 1);
+
+    ecs::Manager<MyResourceSettings> resources_mgr;
+    assert(resources_mgr.resource<RClock>().frame == 0);
+    resources_mgr.resource<RClock>().frame = 3;
+    resources_mgr.resource<RScore>().value += resources_mgr.resource<RClock>().frame * 10;
+    resources_mgr.clear();
+    [[maybe_unused]] const auto &const_resources_mgr(resources_mgr);
+    assert(const_resources_mgr.resource<RScore>().value == 30);
+
     using EntityManager = ecs::Manager<MySettings>;
 
     EntityManager mgr;
@@ -504,5 +682,1051 @@ int main() {
             std::cout << "S2 : " << cPosition.value << std::endl;
         });
 
+    //
+    // Check chunk iteration
+    //
+    EntityManager chunks_mgr;
+    for (int i = 0; i < 10; ++i) {
+        const auto e(chunks_mgr.createIndex());
+        chunks_mgr.addComponent<CTransform>(e, i);
+        if (i != 4) chunks_mgr.addComponent<CPosition>(e).value = i * 10;
+        if (i != 4) chunks_mgr.addTag<Tag0>(e);
+    }
+    chunks_mgr.refresh();
+
+    std::size_t chunk_count{0}, chunk_entities{0};
+    chunks_mgr.forChunksMatching<S2>(
+        [&]([[maybe_unused]] const ecs::EntityIndex first, std::span<CTransform> transforms,
+            [[maybe_unused]] std::span<CPosition> positions) {
+            assert(transforms.size() == positions.size());
+            for (std::size_t i = 0; i < transforms.size(); ++i) {
+                assert(transforms[i].x == static_cast<int>(first.get() + i));
+                assert(positions[i].value == transforms[i].x * 10);
+                transforms[i].x += 100;
+            }
+            ++chunk_count;
+            chunk_entities += transforms.size();
+        });
+    // L'entité 4 n'a pas de CPosition : elle coupe la plage en deux blocs
+    assert(chunk_count == 2);
+    assert(chunk_entities == 9);
+    assert(std::as_const(chunks_mgr).getComponent<CTransform>(ecs::EntityIndex{9}).x == 109);
+    assert(reinterpret_cast<std::uintptr_t>(&std::as_const(chunks_mgr).getComponent<CTransform>(ecs::EntityIndex{0}))
+           % ecs::tools::ColumnAlignment == 0);
+
+    //
+    // Check ranges views
+    //
+    using S2View = decltype(chunks_mgr.view<S2>());
+    static_assert(std::ranges::forward_range<S2View>);
+    static_assert(std::ranges::view<S2View>);
+    static_assert(std::is_same_v<std::ranges::range_reference_t<S2View>,
+                                 std::tuple<ecs::EntityIndex, CTransform &, CPosition &> >);
+
+    std::size_t view_count{0};
+    for ([[maybe_unused]] auto [entity_index, view_transform, view_position]: chunks_mgr.view<S2>()) {
+        assert(entity_index.get() != 4);
+        assert(view_position.value + 1000 == view_transform.x * 10);
+        ++view_count;
+    }
+    assert(view_count == 9);
+
+    [[maybe_unused]] const auto found = std::ranges::find_if(chunks_mgr.view<S2>(), [](const auto &entry) {
+        return std::get<2>(entry).value == 70;
+    });
+    assert(found != chunks_mgr.view<S2>().end());
+    assert(std::get<0>(*found).get() == 7);
+    assert(std::ranges::count_if(chunks_mgr.view<S0>(), [](const auto &) { return true; }) == 10);
+
+    //
+    // Check pair iteration
+    //
+    std::size_t pair_count{0};
+    chunks_mgr.forPairsMatching<S2, S1>(
+        [&pair_count]([[maybe_unused]] const ecs::EntityIndex a, CTransform &, CPosition &,
+                      [[maybe_unused]] const ecs::EntityIndex b, CTransform &) {
+            assert(a != b);
+            ++pair_count;
+        });
+    assert(pair_count == 9 * 10 - 9);
+
+    // Un kill pendant l'itération retire immédiatement l'entité des couples suivants
+    pair_count = 0;
+    chunks_mgr.forPairsMatching<S2, S1>(
+        [&](const ecs::EntityIndex, CTransform &, CPosition &, const ecs::EntityIndex b, CTransform &) {
+            assert(b.get() % 2 == 0);
+            chunks_mgr.kill(b);
+            ++pair_count;
+        }, EvenBroadphase{});
+    assert(pair_count == 5);
+    chunks_mgr.refresh();
+    assert(chunks_mgr.getEntityCount() == 5);
+
+    //
+    // Check change detection
+    //
+    EntityManager changes_mgr;
+    for (int i = 0; i < 4; ++i) {
+        const auto e(changes_mgr.createIndex());
+        changes_mgr.addComponent<CTransform>(e, i);
+        changes_mgr.addComponent<CPosition>(e).value = i;
+        changes_mgr.addTag<Tag0>(e);
+    }
+    changes_mgr.refresh();
+
+    ecs::ChangeTick added_tick{0u}, changed_tick{0u};
+    std::size_t change_count{0};
+    const auto count_changes = [&change_count](auto, CTransform &, CPosition &) { ++change_count; };
+
+    // Premier passage : tout est nouveau
+    changes_mgr.forEntitiesMatching<S2, ecs::Added<CTransform>>(added_tick, count_changes);
+    assert(change_count == 4);
+    change_count = 0;
+    changes_mgr.forEntitiesMatching<S2, ecs::Changed<CPosition>>(changed_tick, count_changes);
+    assert(change_count == 4);
+
+    // Rien n'a bougé depuis
+    change_count = 0;
+    changes_mgr.forEntitiesMatching<S2, ecs::Changed<CPosition>>(changed_tick, count_changes);
+    assert(change_count == 0);
+
+    // Accès mutable et marquage explicite
+    changes_mgr.getComponent<CPosition>(ecs::EntityIndex{1}).value = 42;
+    changes_mgr.markChanged<CPosition>(ecs::EntityIndex{2}, 2);
+    changes_mgr.markChanged<CTransform>(ecs::EntityIndex{0});
+    change_count = 0;
+    changes_mgr.forEntitiesMatching<S2, ecs::Changed<CPosition>>(changed_tick, count_changes);
+    assert(change_count == 3);
+    change_count = 0;
+    changes_mgr.forEntitiesMatching<S2, ecs::Added<CTransform>>(added_tick, count_changes);
+    assert(change_count == 0);
+
+    // Tous les filtres doivent être satisfaits
+    ecs::ChangeTick both_tick{0u};
+    changes_mgr.forEntitiesMatching<S2, ecs::Changed<CTransform>>(both_tick, [](auto, CTransform &, CPosition &) {});
+    changes_mgr.markChanged<CTransform>(ecs::EntityIndex{3});
+    changes_mgr.markChanged<CPosition>(ecs::EntityIndex{3});
+    changes_mgr.markChanged<CPosition>(ecs::EntityIndex{0});
+    change_count = 0;
+    changes_mgr.forEntitiesMatching<S2, ecs::Changed<CTransform>, ecs::Changed<CPosition>>(both_tick, count_changes);
+    assert(change_count == 1);
+
+    //
+    // Check observers
+    //
+    EntityManager events_mgr;
+    EventLog event_log;
+    events_mgr.onAdd<CPosition, &EventLog::onAdded<EntityManager> >(event_log);
+    events_mgr.onRemove<CPosition, &EventLog::onRemoved<EntityManager> >(event_log);
+    events_mgr.onTagAdded<Tag1, &EventLog::onTagged<EntityManager> >(event_log);
+    events_mgr.onKilled<&EventLog::onKilled<EntityManager> >(event_log);
+
+    for (int i = 0; i < 3; ++i) {
+        const auto e(events_mgr.createIndex());
+        events_mgr.addComponent<CPosition>(e).value = i;
+        events_mgr.addTag<Tag1>(e);
+        events_mgr.addTag<Tag1>(e);
+    }
+    // Rien n'est notifié avant le refresh
+    assert(event_log.added == 0);
+    events_mgr.refresh();
+    assert(event_log.added == 3);
+    assert(event_log.tagged == 3);
+
+    // Le kill notifie le retrait des composants de l'entité, puis sa mort
+    events_mgr.kill(ecs::EntityIndex{1});
+    events_mgr.kill(ecs::EntityIndex{1});
+    events_mgr.delComponent<CPosition>(ecs::EntityIndex{2});
+    events_mgr.refresh();
+    assert(event_log.killed == 1);
+    assert(event_log.last_killed_value == 1);
+    assert(event_log.removed == 2);
+    assert(events_mgr.getEntityCount() == 2);
+
+    // Un ajout annulé avant le refresh n'est pas notifié
+    const auto cancelled(events_mgr.createIndex());
+    events_mgr.addComponent<CPosition>(cancelled);
+    events_mgr.delComponent<CPosition>(cancelled);
+    events_mgr.refresh();
+    assert(event_log.added == 3);
+    assert(event_log.removed == 3);
+
+    events_mgr.removeObservers(event_log);
+    events_mgr.kill(ecs::EntityIndex{0});
+    events_mgr.refresh();
+    assert(event_log.killed == 1);
+
+    //
+    // Check hierarchy
+    //
+    using MyHierarchySettings = ecs::Settings<ecs::ComponentList<CTransform, CPosition, ecs::CHierarchy>, MyTagList,
+        MySignatureList>;
+    using HierarchyManager = ecs::Manager<MyHierarchySettings>;
+
+    HierarchyManager tree_mgr;
+    ecs::Hierarchy<HierarchyManager> hierarchy(tree_mgr);
+
+    const auto make_node = [&tree_mgr](const int world, const int local) {
+        const auto handle(tree_mgr.createHandle());
+        tree_mgr.addComponent<CTransform>(handle, world);
+        tree_mgr.addComponent<CPosition>(handle).value = local;
+        return handle;
+    };
+    const auto root(make_node(100, 0));
+    const auto child(make_node(0, 10));
+    const auto grandchild(make_node(0, 1));
+    const auto other(make_node(500, 0));
+
+    // Attacher un sous-arbre existant met à jour les profondeurs de toute sa descendance
+    hierarchy.attach(grandchild, child);
+    hierarchy.attach(child, root);
+    tree_mgr.refresh();
+    assert(hierarchy.size() == 2);
+    assert(std::as_const(tree_mgr).getComponent<ecs::CHierarchy>(grandchild).depth == 2);
+    assert(hierarchy.parentOf(child) == root);
+    assert(!hierarchy.parentOf(root));
+
+    std::size_t compose_count{0};
+    const auto compose = [&compose_count](const CTransform &parent, const CPosition &local, CTransform &world) {
+        world.x = parent.x + local.value;
+        ++compose_count;
+    };
+
+    ecs::ChangeTick tree_tick{0u};
+    hierarchy.propagate<CPosition, CTransform>(tree_tick, compose);
+    assert(compose_count == 2);
+    assert(std::as_const(tree_mgr).getComponent<CTransform>(grandchild).x == 111);
+
+    // Rien n'a changé : aucun recalcul
+    compose_count = 0;
+    hierarchy.propagate<CPosition, CTransform>(tree_tick, compose);
+    assert(compose_count == 0);
+
+    // Seul le sous-arbre modifié est recalculé
+    tree_mgr.getComponent<CPosition>(grandchild).value = 2;
+    hierarchy.propagate<CPosition, CTransform>(tree_tick, compose);
+    assert(compose_count == 1);
+    tree_mgr.getComponent<CTransform>(root).x = 200;
+    compose_count = 0;
+    hierarchy.propagate<CPosition, CTransform>(tree_tick, compose);
+    assert(compose_count == 2);
+    assert(std::as_const(tree_mgr).getComponent<CTransform>(grandchild).x == 212);
+
+    // Changement de parent (en passant par un détachement)
+    hierarchy.detach(child);
+    assert(std::as_const(tree_mgr).getComponent<ecs::CHierarchy>(grandchild).depth == 1);
+    hierarchy.attach(child, other);
+    assert(hierarchy.size() == 2);
+    hierarchy.propagate<CPosition, CTransform>(tree_tick, compose);
+    assert(std::as_const(tree_mgr).getComponent<CTransform>(grandchild).x == 512);
+    assert(!std::as_const(tree_mgr).getComponent<ecs::CHierarchy>(root).first_child);
+
+    // La mort d'un parent tue toute sa descendance
+    tree_mgr.kill(other);
+    tree_mgr.refresh();
+    assert(tree_mgr.getEntityCount() == 1);
+    assert(tree_mgr.isHandleValid(root));
+    assert(hierarchy.size() == 0);
+
+    //
+    // Check snapshot
+    //
+    using MySnapshotSettings = ecs::Settings<ecs::ComponentList<CTransform, CPosition, CName>, MyTagList,
+        MySignatureList, ecs::SystemList<>, MyResourceList>;
+    using SnapshotManager = ecs::Manager<MySnapshotSettings>;
+
+    static_assert(ecs::BulkSnapshotable<CTransform>);
+    static_assert(ecs::HasSnapshotCodec<CName> && !ecs::BulkSnapshotable<CName>);
+    static_assert(std::is_trivially_copyable_v<ecs::CHierarchy>);
+
+    SnapshotManager saved_mgr(4);
+    std::vector<ecs::Handle> saved_handles;
+    for (auto i(0); i < 6; ++i) {
+        const auto handle(saved_mgr.createHandle());
+        saved_mgr.addComponent<CTransform>(handle, i * 10);
+        if (i % 2 == 0) saved_mgr.addComponent<CName>(handle).value = "entity " + std::to_string(i);
+        if (i == 3) saved_mgr.addTag<Tag1>(handle);
+        saved_handles.push_back(handle);
+    }
+    // Les handles morts doivent rester invalides après restauration
+    saved_mgr.kill(saved_handles[1]);
+    saved_mgr.refresh();
+    saved_mgr.resource<RScore>().value = 42;
+
+    std::vector<std::byte> snapshot;
+    saved_mgr.saveSnapshot(snapshot);
+
+    SnapshotManager loaded_mgr(2);
+    loaded_mgr.createHandle();
+    [[maybe_unused]] const auto loaded(loaded_mgr.loadSnapshot(snapshot));
+    assert(loaded);
+    assert(loaded_mgr.getEntityCount() == 5);
+    assert(loaded_mgr.getCapacity() == saved_mgr.getCapacity());
+    assert(loaded_mgr.getChangeTick() == saved_mgr.getChangeTick());
+    assert(loaded_mgr.resource<RScore>().value == 42);
+    assert(!loaded_mgr.isHandleValid(saved_handles[1]));
+    for (const auto i: {0, 2, 3, 4, 5}) {
+        [[maybe_unused]] const auto &handle(saved_handles[static_cast<std::size_t>(i)]);
+        assert(loaded_mgr.isHandleValid(handle));
+        assert(std::as_const(loaded_mgr).getComponent<CTransform>(handle).x == i * 10);
+        assert(loaded_mgr.hasComponent<CName>(handle) == (i % 2 == 0));
+        assert(loaded_mgr.hasTag<Tag1>(handle) == (i == 3));
+    }
+    assert(std::as_const(loaded_mgr).getComponent<CName>(saved_handles[4]).value == "entity 4");
+
+    // Le monde restauré reste utilisable
+    loaded_mgr.kill(saved_handles[0]);
+    loaded_mgr.createHandle();
+    loaded_mgr.refresh();
+    assert(loaded_mgr.getEntityCount() == 5);
+
+    // Images invalides : en-tête rejeté (Manager intact) ou image tronquée (Manager vidé)
+    auto corrupted(snapshot);
+    corrupted[4] = std::byte{0xff};
+    [[maybe_unused]] const auto loaded_corrupted(loaded_mgr.loadSnapshot(corrupted));
+    assert(!loaded_corrupted);
+    assert(loaded_mgr.getEntityCount() == 5);
+    [[maybe_unused]] const auto loaded_truncated(loaded_mgr.loadSnapshot(std::span(snapshot).first(snapshot.size() - 1)));
+    assert(!loaded_truncated);
+    assert(loaded_mgr.getEntityCount() == 0);
+
+    //
+    // Check rollback
+    //
+    SnapshotManager replay_mgr;
+    ecs::Rollback<SnapshotManager> rollback(replay_mgr, 4);
+    [[maybe_unused]] const auto rewound_empty(rollback.rollback(0));
+    assert(!rewound_empty);
+
+    const auto replayed(replay_mgr.createHandle());
+    replay_mgr.addComponent<CTransform>(replayed, 0);
+    replay_mgr.addComponent<CName>(replayed).value = "frame 0";
+    replay_mgr.refresh();
+    rollback.record();
+
+    // Frames 1 à 5 : seul un composant change (et la taille du snapshot, avec CName)
+    for (auto frame(1); frame <= 5; ++frame) {
+        replay_mgr.getComponent<CTransform>(replayed).x = frame;
+        replay_mgr.getComponent<CName>(replayed).value = "frame " + std::string(static_cast<std::size_t>(frame), '+');
+        if (frame == 3) {
+            replay_mgr.createHandle();
+            replay_mgr.refresh();
+        }
+        rollback.record();
+    }
+    // L'historique est limité à 4 frames, et ne contient que des deltas épars
+    assert(rollback.size() == 4);
+    [[maybe_unused]] const auto rewound_too_far(rollback.rollback(5));
+    assert(!rewound_too_far);
+    assert(rollback.deltaBytes() < 4 * 1024);
+
+    // Retour à la frame 2 (avant la création de la seconde entité)
+    [[maybe_unused]] const auto rewound(rollback.rollback(3));
+    assert(rewound);
+    assert(rollback.size() == 1);
+    assert(replay_mgr.getEntityCount() == 1);
+    assert(std::as_const(replay_mgr).getComponent<CTransform>(replayed).x == 2);
+    assert(std::as_const(replay_mgr).getComponent<CName>(replayed).value == "frame ++");
+
+    // Nouvelle simulation depuis la frame 2, puis retour à la frame 2
+    replay_mgr.getComponent<CTransform>(replayed).x = 30;
+    rollback.record();
+    assert(rollback.size() == 2);
+    [[maybe_unused]] const auto rewound_again(rollback.rollback(1));
+    assert(rewound_again);
+    assert(std::as_const(replay_mgr).getComponent<CTransform>(replayed).x == 2);
+
+    //
+    // Check worlds (migration and parallel stepping)
+    //
+    std::array<SnapshotManager, 4> worlds;
+    for (auto &world: worlds) {
+        for (auto i(0); i < 10; ++i) {
+            world.addComponent<CTransform>(world.createIndex(), i);
+        }
+        world.refresh();
+    }
+
+    ecs::tools::ThreadPool pool(3);
+    for (auto step(0); step < 5; ++step) {
+        pool.parallelFor(worlds.size(), [&worlds](const std::size_t world_index) {
+            worlds[world_index].forEntities([&worlds, world_index](const ecs::EntityIndex entity_index) {
+                worlds[world_index].getComponent<CTransform>(entity_index).x += static_cast<int>(world_index);
+            });
+        });
+    }
+    assert(std::as_const(worlds[3]).getComponent<CTransform>(ecs::EntityIndex{0}).x == 15);
+
+    const auto traveller(worlds[0].createHandle());
+    worlds[0].addComponent<CTransform>(traveller, 7);
+    worlds[0].addComponent<CName>(traveller).value = "traveller";
+    worlds[0].addTag<Tag1>(traveller);
+    worlds[0].refresh();
+
+    const auto arrived(ecs::moveEntity(worlds[0], traveller, worlds[1]));
+    worlds[0].refresh();
+    worlds[1].refresh();
+    assert(!worlds[0].isHandleValid(traveller));
+    assert(worlds[0].getEntityCount() == 10);
+    assert(worlds[1].getEntityCount() == 11);
+    assert(std::as_const(worlds[1]).getComponent<CTransform>(arrived).x == 7);
+    assert(std::as_const(worlds[1]).getComponent<CName>(arrived).value == "traveller");
+    assert(worlds[1].hasTag<Tag1>(arrived));
+    assert(!worlds[1].hasComponent<CPosition>(arrived));
+
+    //
+    // Check stats
+    //
+    SnapshotManager stats_mgr(4);
+    for (auto i(0); i < 8; ++i) {
+        const auto index(stats_mgr.createIndex());
+        stats_mgr.addComponent<CTransform>(index, i);
+        if (i % 2 == 0) stats_mgr.addComponent<CPosition>(index);
+        if (i % 4 == 0) stats_mgr.addTag<Tag0>(index);
+    }
+    stats_mgr.kill(ecs::EntityIndex{1});
+    stats_mgr.refresh();
+
+    const auto stats(stats_mgr.stats());
+    assert(stats.size == 7);
+    assert(stats.capacity == stats_mgr.getCapacity());
+    assert(stats.growthCount == 2);
+    assert(stats.columns[0].name == "CTransform");
+    assert(stats.columns[0].occupied == 7);
+    assert(stats.columns[1].occupied == 4);
+    assert(stats.columns[2].occupied == 0);
+    assert(stats.columns[0].allocatedBytes >= stats.capacity * sizeof(CTransform));
+    // S0 (vide) : toutes les entités ; S2 (CTransform, CPosition, Tag0) : entités 0 et 4
+    assert(stats.signatureMatches[0] == 7);
+    assert(stats.signatureMatches[2] == 2);
+    // L'entité 7 a pris la place de l'entité 1 : ses composants ne sont plus à son index
+    assert(stats.outOfOrder == 1);
+    assert(stats.fragmentation() > 0.0);
+    assert(stats.totalBytes() > stats.entityTableBytes + stats.handleTableBytes);
+
+    //
+    // Check enabled
+    //
+    SnapshotManager enabled_mgr;
+    std::vector<ecs::Handle> enabled_handles;
+    for (auto i(0); i < 200; ++i) {
+        const auto handle(enabled_mgr.createHandle());
+        enabled_mgr.addComponent<CTransform>(handle, i);
+        enabled_handles.push_back(handle);
+    }
+    enabled_mgr.refresh();
+
+    // Désactivation en bloc sur plusieurs mots (10 à 149), puis réactivation d'une entité
+    enabled_mgr.setEnabled(ecs::EntityIndex{10}, 140, false);
+    enabled_mgr.setEnabled(enabled_handles[100], true);
+    assert(!enabled_mgr.isEnabled(enabled_handles[10]) && enabled_mgr.isEnabled(enabled_handles[150]));
+    assert(!enabled_mgr.matchesSignature<S0>(ecs::EntityIndex{149}));
+    assert(enabled_mgr.isAlive(enabled_handles[149]));
+
+    [[maybe_unused]] const auto countEnabled = [&enabled_mgr] {
+        auto count(0);
+        enabled_mgr.forEntitiesMatching<S0>([&count](ecs::EntityIndex) { ++count; });
+        return count;
+    };
+    assert(countEnabled() == 61);
+    assert(std::ranges::distance(enabled_mgr.view<S0>()) == 61);
+
+    auto disabled_count(0);
+    enabled_mgr.forDisabledMatching<S0>([&disabled_count](ecs::EntityIndex) { ++disabled_count; });
+    assert(disabled_count == 139);
+    assert(enabled_mgr.stats().disabled == 139);
+
+    // Tag rare : seuls ses porteurs désactivés (12 et 40) sont visités
+    for (const std::size_t index: {12u, 40u, 100u, 160u}) {
+        enabled_mgr.addComponent<CPosition>(enabled_handles[index], static_cast<int>(index));
+        enabled_mgr.addTag<Tag0>(enabled_handles[index]);
+    }
+    std::vector<ecs::EntityIndex> disabled_tagged;
+    enabled_mgr.forDisabledMatching<S2>(
+        [&disabled_tagged](const ecs::EntityIndex entity_index, const CTransform &, const CPosition &) {
+            disabled_tagged.push_back(entity_index);
+        });
+    assert((disabled_tagged == std::vector{ecs::EntityIndex{12}, ecs::EntityIndex{40}}));
+
+    // Le compactage du refresh déplace les entités avec leur état d'activation
+    enabled_mgr.kill(enabled_handles[20]);
+    enabled_mgr.kill(enabled_handles[0]);
+    enabled_mgr.refresh();
+    assert(countEnabled() == 60);
+    assert(enabled_mgr.isEnabled(enabled_handles[199]));
+    assert(!enabled_mgr.isEnabled(enabled_handles[149]));
+    assert(enabled_mgr.isEnabled(enabled_handles[100]));
+
+    // L'état d'activation fait partie du snapshot
+    std::vector<std::byte> enabled_snapshot;
+    enabled_mgr.saveSnapshot(enabled_snapshot);
+    SnapshotManager enabled_copy;
+    [[maybe_unused]] const auto enabled_loaded(enabled_copy.loadSnapshot(enabled_snapshot));
+    assert(enabled_loaded);
+    assert(!enabled_copy.isEnabled(enabled_handles[149]) && enabled_copy.isEnabled(enabled_handles[199]));
+
+    //
+    // Check concurrent creation
+    //
+    SnapshotManager concurrent_mgr;
+    EventLog concurrent_log;
+    concurrent_mgr.onAdd<CTransform, &EventLog::onAdded<SnapshotManager> >(concurrent_log);
+    concurrent_mgr.onTagAdded<Tag0, &EventLog::onTagged<SnapshotManager> >(concurrent_log);
+    concurrent_mgr.addComponent<CTransform>(concurrent_mgr.createIndex(), -1);
+    concurrent_mgr.refresh();
+
+    ecs::tools::ThreadPool creation_pool(3);
+    {
+        // 100 entités réservées, 300 créées : le reste est différé jusqu'à finish()
+        ecs::ConcurrentCreation creation(concurrent_mgr, 100, 8);
+        creation_pool.parallelFor(30, [&creation](const std::size_t task) {
+            auto creator(creation.creator());
+            for (auto i(0); i < 10; ++i) {
+                creator.create([value = static_cast<int>(task) * 10 + i](
+                SnapshotManager &manager, const ecs::EntityIndex index, ecs::Handle) {
+                        manager.addComponent<CTransform>(index, value);
+                        if (value % 2 == 0) manager.addTag<Tag0>(index);
+                    });
+            }
+        });
+        assert(creation.deferredCount() > 0);
+        creation.finish();
+    }
+    concurrent_mgr.refresh();
+
+    assert(concurrent_mgr.getEntityCount() == 301);
+    assert(concurrent_log.added == 301);
+    assert(concurrent_log.tagged == 150);
+
+    std::vector<bool> created(300, false);
+    auto created_tags(0);
+    concurrent_mgr.forEntitiesMatching<S0>([&](const ecs::EntityIndex index) {
+        const auto value(concurrent_mgr.getComponent<CTransform>(index).x);
+        if (value < 0) return;
+        assert(!created[static_cast<std::size_t>(value)]);
+        created[static_cast<std::size_t>(value)] = true;
+        if (concurrent_mgr.hasTag<Tag0>(index)) ++created_tags;
+    });
+    assert(std::ranges::all_of(created, [](const bool value) { return value; }));
+    assert(created_tags == 150);
+
+    //
+    // Check query stats
+    //
+    EntityManager query_mgr;
+    for (auto i(0); i < 10; ++i) {
+        const auto e(query_mgr.createIndex());
+        query_mgr.addComponent<CTransform>(e);
+        if (i % 5 == 0) {
+            query_mgr.addComponent<CPosition>(e);
+            query_mgr.addTag<Tag0>(e);
+        }
+    }
+    query_mgr.refresh();
+    query_mgr.setEnabled(ecs::EntityIndex{9}, false);
+
+    query_mgr.forEntitiesMatching<S2>([](ecs::EntityIndex, CTransform &, CPosition &) {});
+    query_mgr.forEntitiesMatching<S2>([](ecs::EntityIndex, CTransform &, CPosition &) {});
+    query_mgr.forChunksMatching<S0>([](ecs::EntityIndex, auto &&...) {});
+    // Les statistiques sont celles de la dernière frame terminée
+    assert(query_mgr.queryStats()[2].calls == 0);
+    query_mgr.endQueryFrame();
+
+    [[maybe_unused]] const auto &query_s2(query_mgr.queryStats()[static_cast<std::size_t>(MySettings::signatureID<S2>())]);
+    [[maybe_unused]] const auto &query_s0(query_mgr.queryStats()[static_cast<std::size_t>(MySettings::signatureID<S0>())]);
+    if constexpr (ecs::QueryStatsEnabled) {
+        // L'entité désactivée n'est pas visitée par forEntitiesMatching
+        assert(query_s2.calls == 2 && query_s2.visited == 18 && query_s2.matched == 4);
+        assert(query_s2.selectivity() > 0.2 && query_s2.selectivity() < 0.25);
+        assert(query_s0.calls == 1 && query_s0.visited == 10 && query_s0.matched == 9);
+        assert(query_s2.nanoseconds >= 0);
+    } else {
+        assert(query_s2.calls == 0 && query_s2.visited == 0 && query_s0.matched == 0);
+    }
+
+    query_mgr.endQueryFrame();
+    assert(query_mgr.queryStats()[2].calls == 0 && query_mgr.queryStats()[2].visited == 0);
+
+    //
+    // Check owning groups
+    //
+    using SGroup = ecs::Signature<CTransform, CPosition>;
+    using GroupSettings = ecs::Settings<
+        MyComponentsList, MyTagList, ecs::SignatureList<S0, SGroup, S2>,
+        ecs::SystemList<>, ecs::ResourceList<>, ecs::GroupList<SGroup, S2>
+    >;
+    using GroupManager = ecs::Manager<GroupSettings>;
+
+    static_assert(GroupSettings::groupCount() == 2);
+    static_assert(GroupSettings::isGroup<S2>() && !GroupSettings::isGroup<S0>());
+    static_assert(ecs::tools::includes_v<SGroup, S2> && !ecs::tools::includes_v<S2, SGroup>);
+
+    GroupManager group_mgr(8);
+    std::vector<ecs::Handle> group_handles;
+    for (auto i(0); i < 20; ++i) {
+        const auto handle(group_mgr.createHandle());
+        group_handles.push_back(handle);
+        group_mgr.addComponent<CTransform>(handle, i);
+        if (i % 2 == 0) group_mgr.addComponent<CPosition>(handle).value = i * 10;
+        if (i % 4 == 0) group_mgr.addTag<Tag0>(handle);
+    }
+    // La composition des groupes est mise à jour au refresh
+    assert(group_mgr.groupSize<SGroup>() == 0);
+    group_mgr.refresh();
+    assert(group_mgr.groupSize<SGroup>() == 10 && group_mgr.groupSize<S2>() == 5);
+
+    // Les membres occupent le début des colonnes (les plus restrictifs en premier), dans le même ordre
+    const auto checkGroups = [](GroupManager &manager) {
+        std::size_t outer_count{0};
+        const CTransform *previous_transform(nullptr);
+        manager.forGroup<SGroup>([&]([[maybe_unused]] const ecs::EntityIndex entity_index, CTransform &group_transform,
+                                     [[maybe_unused]] CPosition &group_position) {
+            assert(manager.matchesSignature<SGroup>(entity_index));
+            assert(group_position.value == group_transform.x * 10);
+            assert(&std::as_const(manager).getComponent<CTransform>(entity_index) == &group_transform);
+            assert(previous_transform == nullptr || &group_transform == previous_transform + 1);
+            assert(manager.hasTag<Tag0>(entity_index) == (outer_count < manager.groupSize<S2>()));
+            previous_transform = &group_transform;
+            ++outer_count;
+        });
+        assert(outer_count == manager.groupSize<SGroup>());
+
+        std::size_t inner_count{0};
+        manager.forGroup<S2>([&inner_count](ecs::EntityIndex, [[maybe_unused]] const CTransform &group_transform,
+                                            const CPosition &) {
+            assert(group_transform.x % 4 == 0);
+            ++inner_count;
+        });
+        assert(inner_count == manager.groupSize<S2>());
+    };
+    checkGroups(group_mgr);
+
+    group_mgr.delTag<Tag0>(group_handles[4]);
+    group_mgr.delComponent<CPosition>(group_handles[2]);
+    group_mgr.addComponent<CPosition>(group_handles[1]).value = 10;
+    group_mgr.setEnabled(group_handles[8], false);
+    group_mgr.kill(group_handles[0]);
+    assert(group_mgr.groupSize<SGroup>() == 10 && group_mgr.groupSize<S2>() == 5);
+    group_mgr.refresh();
+    assert(group_mgr.groupSize<SGroup>() == 8 && group_mgr.groupSize<S2>() == 2);
+    checkGroups(group_mgr);
+
+    group_mgr.setEnabled(group_handles[8], true);
+    group_mgr.refresh();
+    assert(group_mgr.groupSize<SGroup>() == 9 && group_mgr.groupSize<S2>() == 3);
+    checkGroups(group_mgr);
+
+    // Les groupes sont reconstruits au chargement d'un snapshot
+    std::vector<std::byte> group_blob;
+    group_mgr.saveSnapshot(group_blob);
+    GroupManager group_copy;
+    [[maybe_unused]] const auto group_loaded(group_copy.loadSnapshot(group_blob));
+    assert(group_loaded);
+    assert(group_copy.groupSize<SGroup>() == 9 && group_copy.groupSize<S2>() == 3);
+    assert(std::as_const(group_copy).getComponent<CPosition>(group_handles[1]).value == 10);
+    checkGroups(group_copy);
+
+    group_copy.clear();
+    assert(group_copy.groupSize<SGroup>() == 0 && group_copy.groupSize<S2>() == 0);
+
+    // Création concurrente : seules les entités créées sont reclassées, les places rendues sont ignorées
+    {
+        ecs::ConcurrentCreation group_creation(group_copy, 64, 4);
+        auto creator(group_creation.creator());
+        for (auto i(0); i < 6; ++i) {
+            creator.create([i](GroupManager &manager, const ecs::EntityIndex index, ecs::Handle) {
+                manager.addComponent<CTransform>(index, i);
+                manager.addComponent<CPosition>(index).value = i * 10;
+                if (i % 4 == 0) manager.addTag<Tag0>(index);
+            });
+        }
+        group_creation.finish();
+    }
+    group_copy.refresh();
+    assert(group_copy.getEntityCount() == 6);
+    assert(group_copy.groupSize<SGroup>() == 6 && group_copy.groupSize<S2>() == 2);
+    checkGroups(group_copy);
+
+    //
+    // Check shared components
+    //
+    using SShared = ecs::Signature<CTransform, ecs::Shared<CStyle>>;
+    using SharedSettings = ecs::Settings<
+        ecs::ComponentList<CTransform, ecs::Shared<CStyle>, ecs::Shared<CName>>, MyTagList,
+        ecs::SignatureList<S0, SShared>
+    >;
+    using SharedManager = ecs::Manager<SharedSettings>;
+
+    static_assert(sizeof(ecs::Shared<CStyle>) == sizeof(std::uint32_t));
+
+    SharedManager shared_mgr(4);
+    std::vector<ecs::Handle> shared_handles;
+    for (auto i(0); i < 12; ++i) {
+        const auto handle(shared_mgr.createHandle());
+        shared_handles.push_back(handle);
+        shared_mgr.addComponent<CTransform>(handle, i);
+        shared_mgr.setShared(handle, CStyle{i % 3, 1.5f});
+        if (i % 2 == 0) shared_mgr.setShared(handle, CName{"even"});
+    }
+    shared_mgr.refresh();
+
+    // Les valeurs égales sont dédupliquées : les entités partagent la même instance
+    assert(shared_mgr.sharedCount<CStyle>() == 3 && shared_mgr.sharedCount<CName>() == 1);
+    assert(&shared_mgr.getShared<CStyle>(shared_handles[1]) == &shared_mgr.getShared<CStyle>(shared_handles[4]));
+    assert(&shared_mgr.getShared<CStyle>(shared_handles[1]) != &shared_mgr.getShared<CStyle>(shared_handles[2]));
+
+    // Les requêtes fournissent la valeur partagée (référence constante)
+    int shared_color_sum{0};
+    shared_mgr.forEntitiesMatching<SShared>([&]([[maybe_unused]] const ecs::EntityIndex entity_index,
+                                                [[maybe_unused]] CTransform &shared_transform, const CStyle &style) {
+        assert(style.color == shared_transform.x % 3);
+        assert(&style == &shared_mgr.getShared<CStyle>(entity_index));
+        shared_color_sum += style.color;
+    });
+    assert(shared_color_sum == 12);
+    for (auto [entity_index, view_transform, view_style]: shared_mgr.view<SShared>()) {
+        static_assert(std::is_same_v<decltype(view_style), const CStyle &>);
+        assert(view_style.radius == 1.5f);
+    }
+
+    // Modifier la valeur partagée modifie toutes les entités qui la référencent
+    shared_mgr.updateShared<CStyle>(shared_handles[0], [](CStyle &style) { style.radius = 3.f; });
+    assert(shared_mgr.getShared<CStyle>(shared_handles[9]).radius == 3.f);
+    assert(shared_mgr.getShared<CStyle>(shared_handles[1]).radius == 1.5f);
+
+    // Une valeur n'est libérée que lorsque plus aucune entité ne la référence
+    shared_mgr.setShared(shared_handles[1], CStyle{7, 1.5f});
+    assert(shared_mgr.sharedCount<CStyle>() == 4);
+    shared_mgr.setShared(shared_handles[1], CStyle{1, 1.5f});
+    assert(shared_mgr.sharedCount<CStyle>() == 3);
+    for (const std::size_t index: {0u, 3u, 6u}) shared_mgr.delComponent<ecs::Shared<CStyle>>(shared_handles[index]);
+    assert(shared_mgr.sharedCount<CStyle>() == 3);
+    shared_mgr.kill(shared_handles[9]);
+    assert(shared_mgr.sharedCount<CStyle>() == 3);
+    shared_mgr.refresh();
+    assert(shared_mgr.sharedCount<CStyle>() == 2);
+    for (std::size_t i{0}; i < 12; i += 2) shared_mgr.kill(shared_handles[i]);
+    shared_mgr.refresh();
+    assert(shared_mgr.sharedCount<CName>() == 0);
+    assert(shared_mgr.stats().sharedBytes > 0);
+
+    // Les valeurs partagées font partie du snapshot, y compris les emplacements libres
+    std::vector<std::byte> shared_blob;
+    shared_mgr.saveSnapshot(shared_blob);
+    SharedManager shared_copy;
+    [[maybe_unused]] const auto shared_loaded(shared_copy.loadSnapshot(shared_blob));
+    assert(shared_loaded);
+    assert(shared_copy.sharedCount<CStyle>() == 2 && shared_copy.sharedCount<CName>() == 0);
+    assert(shared_copy.getShared<CStyle>(shared_handles[1]) == (CStyle{1, 1.5f}));
+    assert(&shared_copy.getShared<CStyle>(shared_handles[1]) == &shared_copy.getShared<CStyle>(shared_handles[7]));
+    shared_copy.setShared(shared_handles[1], CName{"odd"});
+    assert(shared_copy.sharedCount<CName>() == 1);
+
+    // Migration : la valeur est référencée dans la table du monde destination
+    const auto migrated(ecs::moveEntity(shared_copy, shared_handles[1], shared_mgr));
+    shared_copy.refresh();
+    shared_mgr.refresh();
+    assert(shared_copy.sharedCount<CName>() == 0);
+    assert(shared_mgr.getShared<CName>(migrated).value == "odd");
+    assert(&shared_mgr.getShared<CStyle>(migrated) == &shared_mgr.getShared<CStyle>(shared_handles[7]));
+
+    //
+    // Check bulk kill
+    //
+    EntityManager kill_mgr;
+    std::vector<ecs::Handle> kill_handles;
+    for (auto i(0); i < 100; ++i) {
+        const auto handle(kill_mgr.createHandle());
+        kill_handles.push_back(handle);
+        kill_mgr.addComponent<CTransform>(handle, i);
+        kill_mgr.addComponent<CPosition>(handle).value = i;
+        if (i != 50) kill_mgr.addTag<Tag0>(handle);
+    }
+    kill_mgr.refresh();
+
+    // L'entité 50 (sans Tag0) ne correspond pas à la signature et n'est pas évaluée
+    [[maybe_unused]] const auto killed_tens(kill_mgr.killIf<S2>([](const CTransform &kill_transform, const CPosition &) {
+        return kill_transform.x % 10 == 0;
+    }));
+    assert(killed_tens == 9);
+    assert(kill_mgr.isAlive(kill_handles[1]) && !kill_mgr.isAlive(kill_handles[10]) && kill_mgr.isAlive(kill_handles[50]));
+    // Les entités déjà tuées ne sont pas comptées une seconde fois
+    [[maybe_unused]] const auto killed_again(kill_mgr.killIf<S2>([](const CTransform &kill_transform, const CPosition &) {
+        return kill_transform.x % 10 == 0;
+    }));
+    assert(killed_again == 0);
+    kill_mgr.refresh();
+    assert(kill_mgr.getEntityCount() == 91);
+    [[maybe_unused]] const auto killed_none(kill_mgr.killIf<S2>([](const CTransform &, const CPosition &) { return false; }));
+    assert(killed_none == 0);
+
+    // Groupe possédant : évaluation sur le début des colonnes
+    [[maybe_unused]] const auto group_before(group_mgr.groupSize<SGroup>());
+    [[maybe_unused]] const auto killed_members(group_mgr.killIf<SGroup>([](const CTransform &kill_transform, const CPosition &) {
+        return kill_transform.x < 5;
+    }));
+    assert(killed_members == 2);
+    group_mgr.refresh();
+    assert(group_mgr.groupSize<SGroup>() == group_before - 2);
+    checkGroups(group_mgr);
+
+    // Membres tués ou désactivés depuis le dernier refresh : ni tués ni comptés
+    group_mgr.kill(group_handles[6]);
+    group_mgr.setEnabled(group_handles[8], false);
+    [[maybe_unused]] const auto killed_pending(group_mgr.killIf<SGroup>([](const CTransform &kill_transform, const CPosition &) {
+        return kill_transform.x <= 10;
+    }));
+    assert(killed_pending == 1);
+    assert(group_mgr.isAlive(group_handles[8]) && !group_mgr.isAlive(group_handles[10]));
+    group_mgr.setEnabled(group_handles[8], true);
+    group_mgr.refresh();
+    assert(group_mgr.groupSize<SGroup>() == group_before - 4);
+    checkGroups(group_mgr);
+
+    // Les composants partagés sont fournis par leur valeur
+    [[maybe_unused]] const auto shared_before(shared_mgr.getEntityCount());
+    [[maybe_unused]] const auto killed_shared(shared_mgr.killIf<SShared>([](const CTransform &, const CStyle &style) {
+        return style.color == 1;
+    }));
+    assert(killed_shared == 3);
+    shared_mgr.refresh();
+    assert(shared_mgr.getEntityCount() == shared_before - 3);
+
+    //
+    // Check tick tiers
+    //
+    using STicked = ecs::Signature<CPosition, ecs::CTickTier>;
+    using TickSettings = ecs::Settings<ecs::ComponentList<CPosition, ecs::CTickTier>, MyTagList,
+                                       ecs::SignatureList<STicked>>;
+    ecs::Manager<TickSettings> tick_mgr;
+    ecs::TickTiers tick_tiers;
+    for (auto i(0); i < 32; ++i) {
+        const auto entity_index(tick_mgr.createIndex());
+        tick_mgr.addComponent<CPosition>(entity_index).value = i;
+        tick_tiers.init(tick_mgr.addComponent<ecs::CTickTier>(entity_index), static_cast<std::uint8_t>(i / 8));
+    }
+    tick_mgr.refresh();
+
+    // Chaque entité intègre exactement le temps écoulé jusqu'à sa dernière mise à jour
+    std::array<float, 32> integrated{};
+    std::array<std::uint32_t, 32> updated_at{};
+    const auto tick = [&](const float delta_time) {
+        tick_tiers.beginFrame(delta_time);
+        std::array<std::size_t, ecs::TickTiers::TierCount> due{};
+        tick_mgr.forEntitiesMatching<STicked>([&](ecs::EntityIndex, const CPosition &tick_position, ecs::CTickTier &tier) {
+            if (!tick_tiers.isDue(tier)) return;
+            ++due[tier.tier];
+            integrated[static_cast<std::size_t>(tick_position.value)] += tick_tiers.consume(tier);
+            updated_at[static_cast<std::size_t>(tick_position.value)] = tick_tiers.frame();
+        });
+        return due;
+    };
+    for (auto frame(1u); frame <= 16; ++frame) {
+        // Les huit entités d'un palier sont réparties uniformément sur les frames de sa période
+        const auto due(tick(0.25f));
+        assert(due[0] == 8 && due[1] == 4 && due[2] == 2 && due[3] == 1);
+    }
+    for (std::size_t i{0}; i < 32; ++i) {
+        assert(integrated[i] == 0.25f * static_cast<float>(updated_at[i]));
+    }
+
+    // Un changement de palier conserve le temps non encore intégré
+    tick_mgr.forEntitiesMatching<STicked>([&tick_tiers](ecs::EntityIndex, const CPosition &, ecs::CTickTier &tier) {
+        tick_tiers.assign(tier, static_cast<std::uint8_t>(3 - tier.tier));
+    });
+    for (auto frame(0); frame < 8; ++frame) tick(0.5f);
+    for (std::size_t i{0}; i < 32; ++i) {
+        assert(integrated[i] == 4.f + 0.5f * static_cast<float>(updated_at[i] - 16));
+    }
+
+    //
+    // Check time-sliced queries
+    //
+    tick_mgr.setEnabled(ecs::EntityIndex{5}, false);
+    std::array<int, 32> sliced_visits{};
+    const auto sliced_visit = [&sliced_visits](ecs::EntityIndex, const CPosition &sliced_position, ecs::CTickTier &) {
+        ++sliced_visits[static_cast<std::size_t>(sliced_position.value)];
+    };
+
+    // Budget nul : SliceCheckInterval entités par appel, reprises là où l'appel précédent s'est arrêté
+    ecs::QueryCursor cursor;
+    std::array<bool, 4> slices_done{};
+    slices_done[0] = tick_mgr.forEntitiesMatching<STicked>(cursor, std::chrono::microseconds{0}, sliced_visit);
+    assert(cursor.next == ecs::EntityIndex{9} && cursor.passes == 0);
+    for (std::size_t slice{1}; slice < slices_done.size(); ++slice) {
+        slices_done[slice] = tick_mgr.forEntitiesMatching<STicked>(cursor, std::chrono::microseconds{0}, sliced_visit);
+    }
+    assert((slices_done == std::array{false, false, false, true}));
+    assert(cursor.next == ecs::EntityIndex{0} && cursor.passes == 1);
+    for (std::size_t i{0}; i < 32; ++i) {
+        assert(sliced_visits[i] == (i == 5 ? 0 : 1));
+    }
+
+    // Budget suffisant : la passe se termine en un appel
+    [[maybe_unused]] const auto pass_done(tick_mgr.forEntitiesMatching<STicked>(cursor, std::chrono::seconds{1}, sliced_visit));
+    assert(pass_done);
+    assert(cursor.passes == 2 && sliced_visits[31] == 2);
+
+    // Passe approximative : le refresh déplace la dernière entité (31) avant le curseur, elle
+    // n'est vue qu'à la passe suivante
+    tick_mgr.forEntitiesMatching<STicked>(cursor, std::chrono::microseconds{0}, sliced_visit);
+    tick_mgr.kill(ecs::EntityIndex{0});
+    tick_mgr.refresh();
+    [[maybe_unused]] const auto moved_pass_done(
+        tick_mgr.forEntitiesMatching<STicked>(cursor, std::chrono::seconds{1}, sliced_visit));
+    assert(moved_pass_done && sliced_visits[30] == 3 && sliced_visits[31] == 2);
+    [[maybe_unused]] const auto next_pass_done(
+        tick_mgr.forEntitiesMatching<STicked>(cursor, std::chrono::seconds{1}, sliced_visit));
+    assert(next_pass_done && sliced_visits[31] == 3);
+
+    //
+    // Check tag index
+    //
+    ecs::tools::RoaringBitmap evens;
+    for (std::uint32_t value{0}; value < 10000; value += 2) evens.add(value);
+    evens.add(70000);
+    evens.add(70001);
+    [[maybe_unused]] const auto added_twice(evens.add(4));
+    assert(evens.cardinality() == 5002 && !added_twice);
+    assert(evens.contains(9998) && !evens.contains(9999) && evens.contains(70001));
+    assert(*evens.nextFrom(9999) == 70000 && !evens.nextFrom(70002));
+
+    ecs::tools::RoaringBitmap odds;
+    for (std::uint32_t value{1}; value < 100; value += 2) odds.add(value);
+    odds.add(10);
+    odds.add(70001);
+    const auto evens_and_odds(ecs::tools::RoaringBitmap::intersect(evens, odds));
+    assert(evens_and_odds.cardinality() == 2 && evens_and_odds.contains(10) && evens_and_odds.contains(70001));
+    assert(ecs::tools::RoaringBitmap::unite(evens, odds).cardinality() == 5052);
+
+    // Un ensemble redevenu creux repasse en tableau, des valeurs consécutives passent en plages
+    [[maybe_unused]] const auto dense_bytes(evens.allocatedBytes());
+    for (std::uint32_t value{0}; value < 8000; value += 2) evens.remove(value);
+    assert(evens.cardinality() == 1002 && evens.allocatedBytes() < dense_bytes);
+
+    ecs::tools::RoaringBitmap range;
+    for (std::uint32_t value{1000}; value < 6000; ++value) range.add(value);
+    range.optimize();
+    assert(range.cardinality() == 5000 && range.allocatedBytes() < 256);
+    assert(range.contains(3000) && !range.contains(6000) && *range.nextFrom(0) == 1000 && !range.nextFrom(6000));
+    [[maybe_unused]] const auto removed(range.remove(3000));
+    assert(removed && !range.contains(3000) && range.cardinality() == 4999);
+    range.removeFrom(5000);
+    assert(range.cardinality() == 3999 && range.contains(4999) && !range.nextFrom(5000));
+
+    // Les porteurs d'un tag suivent les entités tuées et déplacées par le refresh
+    using STagged = ecs::Signature<CPosition, Tag1>;
+    using TagIndexSettings = ecs::Settings<MyComponentsList, MyTagList, ecs::SignatureList<S2, STagged>>;
+    ecs::Manager<TagIndexSettings> tag_mgr;
+    std::vector<ecs::Handle> tag_handles;
+    for (auto i(0); i < 200; ++i) {
+        const auto handle(tag_mgr.createHandle());
+        tag_handles.push_back(handle);
+        tag_mgr.addComponent<CPosition>(handle).value = i;
+        if (i % 50 == 0) tag_mgr.addTag<Tag1>(handle);
+    }
+    tag_mgr.refresh();
+    assert(tag_mgr.taggedEntities<Tag1>().cardinality() == 4);
+
+    for (std::size_t i{0}; i < 20; ++i) tag_mgr.kill(tag_handles[i]);
+    tag_mgr.delTag<Tag1>(tag_handles[100]);
+    tag_mgr.refresh();
+
+    [[maybe_unused]] const auto tagged_values = [&tag_mgr]() {
+        std::vector<int> values;
+        tag_mgr.forEntitiesMatching<STagged>([&values](ecs::EntityIndex, const CPosition &tagged_position) {
+            values.push_back(tagged_position.value);
+        });
+        return values;
+    };
+    assert((tagged_values() == std::vector<int>{150, 50} || tagged_values() == std::vector<int>{50, 150}));
+    assert(tag_mgr.taggedEntities<Tag1>().cardinality() == 2);
+    tag_mgr.taggedEntities<Tag1>().forEach([&tag_mgr]([[maybe_unused]] const std::uint32_t tagged_index) {
+        assert(tag_mgr.hasTag<Tag1>(ecs::EntityIndex{tagged_index}));
+    });
+
+    tag_mgr.setEnabled(tag_handles[50], false);
+    assert(tagged_values() == std::vector<int>{150});
+
+    //
+    // Check mapped columns
+    //
+    {
+        // Une colonne déplacée ne garde aucun pointeur vers le stockage transféré
+        ecs::impl::MappableColumn<int> column;
+        column.resize(3);
+        column[2] = 5;
+        auto moved_column(std::move(column));
+        assert(moved_column.size() == 3 && moved_column[2] == 5);
+        assert(column.size() == 0 && column.data() == nullptr);
+        column = std::move(moved_column);
+        assert(column.size() == 3 && column[2] == 5 && moved_column.size() == 0);
+        moved_column.resize(2);
+        assert(moved_column[1] == 0);
+    }
+    if constexpr (ecs::tools::MappedFile::Supported) {
+        const auto world_directory(std::filesystem::temp_directory_path() / "ecs_test_mapped_world");
+        std::filesystem::remove_all(world_directory);
+
+        SnapshotManager mapped_mgr(4);
+        std::vector<ecs::Handle> mapped_handles;
+        mapped_handles.push_back(mapped_mgr.createHandle());
+        mapped_mgr.addComponent<CTransform>(mapped_handles.back(), -1);
+        [[maybe_unused]] const auto mapped(mapped_mgr.mapColumns(world_directory));
+        assert(mapped && mapped_mgr.isMapped());
+        assert(mapped_mgr.stats().columns[0].mapped && !mapped_mgr.stats().columns[2].mapped);
+
+        // Les colonnes projetées grandissent en étendant leurs fichiers
+        for (auto i(1); i < 1000; ++i) {
+            const auto handle(mapped_mgr.createHandle());
+            mapped_mgr.addComponent<CTransform>(handle, i * 10);
+            mapped_mgr.addComponent<CPosition>(handle).value = i;
+            if (i % 100 == 0) mapped_mgr.addComponent<CName>(handle).value = "entity " + std::to_string(i);
+            mapped_handles.push_back(handle);
+        }
+        mapped_mgr.kill(mapped_handles[1]);
+        mapped_mgr.refresh();
+        assert(mapped_mgr.getCapacity() >= 1000);
+        assert(std::as_const(mapped_mgr).getComponent<CTransform>(mapped_handles[0]).x == -1);
+        assert(std::as_const(mapped_mgr).getComponent<CTransform>(mapped_handles[999]).x == 9990);
+        [[maybe_unused]] const auto saved(mapped_mgr.saveMapped());
+        assert(saved);
+
+        // Un fichier de colonne manquant est détecté avant toute projection : Manager intact
+        SnapshotManager reopened_mgr;
+        reopened_mgr.addComponent<CTransform>(reopened_mgr.createIndex(), 7);
+        reopened_mgr.refresh();
+        const auto ticks_file(world_directory / "ticks_1.bin");
+        std::filesystem::rename(ticks_file, world_directory / "ticks_1.bak");
+        [[maybe_unused]] const auto opened_incomplete(reopened_mgr.openMapped(world_directory));
+        assert(!opened_incomplete && !reopened_mgr.isMapped() && reopened_mgr.getEntityCount() == 1);
+        std::filesystem::rename(world_directory / "ticks_1.bak", ticks_file);
+
+        // Le monde est rouvert en projetant ses fichiers ; seul world.snapshot est relu
+        [[maybe_unused]] const auto opened(reopened_mgr.openMapped(world_directory));
+        assert(opened && reopened_mgr.isMapped());
+        assert(reopened_mgr.getEntityCount() == 999);
+        assert(!reopened_mgr.isHandleValid(mapped_handles[1]));
+        for (std::size_t i{2}; i < mapped_handles.size(); ++i) {
+            [[maybe_unused]] const auto &handle(mapped_handles[i]);
+            assert(std::as_const(reopened_mgr).getComponent<CTransform>(handle).x == static_cast<int>(i) * 10);
+            assert(std::as_const(reopened_mgr).getComponent<CPosition>(handle).value == static_cast<int>(i));
+            assert(reopened_mgr.hasComponent<CName>(handle) == (i % 100 == 0));
+        }
+        assert(std::as_const(reopened_mgr).getComponent<CName>(mapped_handles[500]).value == "entity 500");
+
+        // Une image sans colonnes est refusée par un Manager en mémoire
+        std::ifstream world_file(world_directory / "world.snapshot", std::ios::binary | std::ios::ate);
+        std::vector<std::byte> external_snapshot(static_cast<std::size_t>(world_file.tellg()));
+        world_file.seekg(0);
+        world_file.read(reinterpret_cast<char *>(external_snapshot.data()),
+                        static_cast<std::streamsize>(external_snapshot.size()));
+        SnapshotManager memory_mgr;
+        [[maybe_unused]] const auto loaded_external(memory_mgr.loadSnapshot(external_snapshot));
+        assert(!loaded_external);
+
+        std::filesystem::remove_all(world_directory);
+    }
+
     return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
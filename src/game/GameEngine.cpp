@@ -12,7 +12,7 @@ GameEngine::GameEngine(const std::string &configuration_file_path, const std::st
       assets_(configuration_manager_) {
     auto &[title, fullscreen, width, height] = configuration_manager_.getWindowSettings();
     auto &[depth_bits, stencil_bits, anti_aliasing_level, major_version, minor_version, attribute_flags, framerate_limit
-        , vertical_sync_enabled] = configuration_manager_.getGraphicsSettings();
+        , vertical_sync_enabled, render_thread] = configuration_manager_.getGraphicsSettings();
 
     if (fullscreen) {
         this->window_ = sf::RenderWindow(sf::VideoMode({
@@ -109,15 +109,87 @@ auto GameEngine::run() -> void {
         std::cerr << "ImGui window init error" << std::endl;
     }
 
+    if (configuration_manager_.getGraphicsSettings().render_thread) {
+        runWithRenderThread();
+    } else {
+        running_ = true;
+        while (running_) {
+            this->update();
+            this->current_scene_->publishRenderState();
+            this->render(*this->current_scene_);
+
+            running_ = !this->current_scene_->hasEnded();
+        }
+    }
+
+    ImGui::SFML::Shutdown(this->window_);
+}
+
+auto GameEngine::runWithRenderThread() -> void {
+    // Le contexte OpenGL appartient désormais au thread de rendu
+    if (!this->window_.setActive(false)) {
+        std::cerr << "OpenGL context deactivation failed" << std::endl;
+    }
+
+    std::shared_ptr<Scene> rendered_scene;
+    bool frame_pending = false;
+    bool stopping = false;
+
+    std::jthread render_thread([&] {
+        if (!this->window_.setActive(true)) {
+            std::cerr << "OpenGL context activation failed (render thread)" << std::endl;
+        }
+
+        while (true) {
+            std::shared_ptr<Scene> scene;
+            {
+                std::unique_lock lock(render_mutex_);
+                render_condition_.wait(lock, [&] { return frame_pending || stopping; });
+                if (stopping) break;
+                scene = rendered_scene;
+            }
+
+            // Lecture de la frame publiée pendant que la simulation produit la suivante
+            this->render(*scene);
+
+            {
+                std::lock_guard lock(render_mutex_);
+                frame_pending = false;
+            }
+            render_condition_.notify_all();
+        }
+
+        (void) this->window_.setActive(false);
+    });
+
     running_ = true;
     while (running_) {
         this->update();
-        this->render();
+        this->current_scene_->extractRenderState();
+
+        {
+            // La bascule attend que le rendu de la frame précédente soit terminé
+            std::unique_lock lock(render_mutex_);
+            render_condition_.wait(lock, [&] { return !frame_pending; });
+            this->current_scene_->swapRenderState();
+            rendered_scene = this->current_scene_;
+            frame_pending = true;
+        }
+        render_condition_.notify_all();
 
         running_ = !this->current_scene_->hasEnded();
     }
 
-    ImGui::SFML::Shutdown(this->window_);
+    {
+        std::lock_guard lock(render_mutex_);
+        stopping = true;
+    }
+    render_condition_.notify_all();
+    render_thread.join();
+
+    if (!this->window_.setActive(true)) {
+        std::cerr << "OpenGL context activation failed" << std::endl;
+    }
 }
 
 auto GameEngine::configurationManager() -> tools::ConfigurationManager & {
@@ -149,8 +221,8 @@ auto GameEngine::getAssets() -> Assets & {
     return this->assets_;
 }
 
-auto GameEngine::render() -> void {
+auto GameEngine::render(Scene &scene) -> void {
     this->window_.clear();
-    this->current_scene_->render(window_);
+    scene.render(window_);
     this->window_.display();
 }
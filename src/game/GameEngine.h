@@ -6,6 +6,10 @@
 
 #include "pch.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "Assets.h"
 #include "scenes/Scene.h"
 #include "tools/ConfigurationManager.h"
@@ -39,9 +43,19 @@ class GameEngine {
     sf::Clock delta_clock_;
     Assets assets_;
 
+    // Synchronisation avec le thread de rendu (graphics.render_thread)
+    std::mutex render_mutex_;
+    std::condition_variable render_condition_;
+
     auto update() -> void;
 
-    auto render() -> void;
+    auto render(Scene &scene) -> void;
+
+    /// @brief Boucle principale avec rendu dans un thread dédié
+    ///
+    /// La simulation de la frame N + 1 s'exécute pendant le rendu de la frame N : la scène
+    /// publie l'état nécessaire au rendu dans un double tampon, basculé entre deux frames.
+    auto runWithRenderThread() -> void;
 
     // TODO : sUserInput devrait se trouver ici...
 public:
@@ -7,9 +7,28 @@
 
 #include "EcsTypes.h"
 #include "components/Components.h"
+#include "resources/Resources.h"
 #include "signatures/Signatures.h"
+#include "systems/Systems.h"
 #include "tags/Tags.h"
 
-using GameSettings = ecs::Settings<GameComponentsList, GameTagsList, GameSignaturesList>;
+using GameSettings = ecs::Settings<
+    GameComponentsList,
+    GameTagsList,
+    GameSignaturesList,
+    GameSystemsList,
+    GameResourcesList,
+    GameGroupsList
+>;
+
+// Les systèmes en conflit doivent conserver l'ordre historique de GameScene::update
+static_assert(GameSettings::SystemSchedule::stageOf<EnemySpawnerSystem>() == 0);
+static_assert(GameSettings::SystemSchedule::stageOf<TickTierSystem>() == 1);
+static_assert(GameSettings::SystemSchedule::stageOf<MovementSystem>() == 2);
+static_assert(GameSettings::SystemSchedule::stageOf<HierarchySystem>() == 3);
+static_assert(GameSettings::SystemSchedule::stageOf<CollisionSystem>() == 4);
+static_assert(GameSettings::SystemSchedule::stageOf<UserInputSystem>() == 5);
+static_assert(GameSettings::SystemSchedule::stageOf<LifespanSystem>() == 6);
+static_assert(GameSettings::SystemSchedule::stageOf<GUISystem>() == 7);
 
 #endif //GAME_SETTINGS_H
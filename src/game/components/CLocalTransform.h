@@ -0,0 +1,15 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef CLOCALTRANSFORM_H
+#define CLOCALTRANSFORM_H
+
+// Transformation relative au parent (voir ecs::Hierarchy) : le CTransform de l'entité
+// en est déduit à chaque propagation
+struct CLocalTransform {
+    sf::Vector2f position;
+    float angle{};
+};
+
+#endif //CLOCALTRANSFORM_H
@@ -5,8 +5,45 @@
 #ifndef CSHAPE_H
 #define CSHAPE_H
 
+#include "Snapshot.h"
+
 struct CShape {
     sf::CircleShape circle;
 };
 
+/**
+ * Sérialisation de CShape dans les snapshots (sf::CircleShape n'est pas copiable en bloc).
+ * La position et la rotation ne sont pas sauvegardées : elles sont resynchronisées depuis
+ * CTransform au rendu.
+ */
+template<>
+struct ecs::SnapshotCodec<CShape> {
+    static void write(SnapshotWriter &writer, const CShape &shape) {
+        writer.write(shape.circle.getRadius());
+        writer.write(shape.circle.getPointCount());
+        writer.write(shape.circle.getFillColor());
+        writer.write(shape.circle.getOutlineColor());
+        writer.write(shape.circle.getOutlineThickness());
+        writer.write(shape.circle.getOrigin());
+    }
+
+    static void read(SnapshotReader &reader, CShape &shape) {
+        float radius{}, outline_thickness{};
+        std::size_t point_count{};
+        sf::Color fill_color, outline_color;
+        sf::Vector2f origin;
+
+        if (!reader.read(radius) || !reader.read(point_count) || !reader.read(fill_color) ||
+            !reader.read(outline_color) || !reader.read(outline_thickness) || !reader.read(origin)) {
+            return;
+        }
+
+        shape.circle = sf::CircleShape(radius, point_count);
+        shape.circle.setFillColor(fill_color);
+        shape.circle.setOutlineColor(outline_color);
+        shape.circle.setOutlineThickness(outline_thickness);
+        shape.circle.setOrigin(origin);
+    }
+};
+
 #endif //CSHAPE_H
@@ -8,12 +8,15 @@
 #include "pch.h"
 
 #include "EcsTypes.h"
+#include "Hierarchy.h"
+#include "TickTiers.h"
 #include "CTransform.h"
 #include "CCollision.h"
 #include "CScore.h"
 #include "CShape.h"
 #include "CLifespan.h"
 #include "CInput.h"
+#include "CLocalTransform.h"
 
 using GameComponentsList = ecs::ComponentList<
     CTransform,
@@ -21,7 +24,10 @@ using GameComponentsList = ecs::ComponentList<
     CScore,
     CShape,
     CLifespan,
-    CInput
+    CInput,
+    CLocalTransform,
+    ecs::CHierarchy,
+    ecs::CTickTier
 >;
 
 #endif //COMPONENTS_H
@@ -0,0 +1,26 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#include "GridBroadphase.h"
+
+GridBroadphase::GridBroadphase(const float cell_size)
+    : cell_size_{cell_size}
+{
+    assert(cell_size_ > 0.f);
+}
+
+auto GridBroadphase::cellCoordinate(const float value) const -> std::int32_t
+{
+    return static_cast<std::int32_t>(std::floor(value / cell_size_));
+}
+
+auto GridBroadphase::cellKey(const std::int32_t x, const std::int32_t y) -> std::int64_t
+{
+    return (static_cast<std::int64_t>(x) << 32) | static_cast<std::int64_t>(static_cast<std::uint32_t>(y));
+}
+
+auto GridBroadphase::sortCells() -> void
+{
+    std::ranges::sort(cells_, {}, &CellEntry::cell);
+}
@@ -0,0 +1,106 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef GRID_BROADPHASE_H
+#define GRID_BROADPHASE_H
+
+#include "pch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <utility>
+
+#include "components/Components.h"
+
+/// @brief Broadphase à grille uniforme pour ecs::Manager::forPairsMatching
+///
+/// Les entités B sont rangées dans la cellule contenant leur centre (tableau trié par cellule).
+/// Chaque entité A ne teste que les cellules recouvertes par son rayon de collision élargi
+/// du plus grand rayon des entités B. Les entités doivent avoir CTransform et CCollision.
+///
+/// Les tampons sont conservés d'un appel à l'autre : aucune allocation en régime établi.
+class GridBroadphase {
+    struct CellEntry {
+        std::int64_t cell;
+        ecs::EntityIndex entity_index;
+    };
+
+    float cell_size_;
+    std::vector<CellEntry> cells_;
+
+    [[nodiscard]] auto cellCoordinate(float value) const -> std::int32_t;
+
+    [[nodiscard]] static auto cellKey(std::int32_t x, std::int32_t y) -> std::int64_t;
+
+    auto sortCells() -> void;
+
+    /// @brief Émet les entités B dont le centre est dans la cellule (x, y)
+    template<typename TEmit>
+    auto forEachInCell(std::int32_t x, std::int32_t y, TEmit &&emit) const -> void;
+
+public:
+    explicit GridBroadphase(float cell_size);
+
+    template<typename TManager, typename TEmit>
+    auto forEachCandidate(TManager &manager,
+                          std::span<const ecs::EntityIndex> entities_a,
+                          std::span<const ecs::EntityIndex> entities_b,
+                          TEmit &&emit) -> void;
+};
+
+template<typename TEmit>
+auto GridBroadphase::forEachInCell(const std::int32_t x, const std::int32_t y, TEmit &&emit) const -> void
+{
+    const auto key = cellKey(x, y);
+    const auto range = std::ranges::equal_range(cells_, key, {}, &CellEntry::cell);
+    for (const auto &entry: range)
+    {
+        emit(entry.entity_index);
+    }
+}
+
+template<typename TManager, typename TEmit>
+auto GridBroadphase::forEachCandidate(TManager &manager,
+                                      const std::span<const ecs::EntityIndex> entities_a,
+                                      const std::span<const ecs::EntityIndex> entities_b,
+                                      TEmit &&emit) -> void
+{
+    cells_.clear();
+
+    // Lecture seule : les composants ne doivent pas être marqués comme modifiés
+    const auto &reader = std::as_const(manager);
+
+    float max_radius_b = 0.f;
+    for (const auto entity_b: entities_b)
+    {
+        const auto &position = reader.template getComponent<CTransform>(entity_b).position;
+        max_radius_b = std::max(max_radius_b, reader.template getComponent<CCollision>(entity_b).radius);
+        cells_.push_back({cellKey(cellCoordinate(position.x), cellCoordinate(position.y)), entity_b});
+    }
+    sortCells();
+
+    for (const auto entity_a: entities_a)
+    {
+        const auto &position = reader.template getComponent<CTransform>(entity_a).position;
+        const auto reach = reader.template getComponent<CCollision>(entity_a).radius + max_radius_b;
+
+        const auto min_x = cellCoordinate(position.x - reach);
+        const auto max_x = cellCoordinate(position.x + reach);
+        const auto min_y = cellCoordinate(position.y - reach);
+        const auto max_y = cellCoordinate(position.y + reach);
+
+        for (auto y = min_y; y <= max_y; ++y)
+        {
+            for (auto x = min_x; x <= max_x; ++x)
+            {
+                forEachInCell(x, y, [&emit, entity_a](const ecs::EntityIndex entity_b) {
+                    emit(entity_a, entity_b);
+                });
+            }
+        }
+    }
+}
+
+#endif //GRID_BROADPHASE_H
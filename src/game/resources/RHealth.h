@@ -0,0 +1,12 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef RHEALTH_H
+#define RHEALTH_H
+
+struct RHealth {
+    int value{5};
+};
+
+#endif //RHEALTH_H
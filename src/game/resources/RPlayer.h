@@ -0,0 +1,17 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef RPLAYER_H
+#define RPLAYER_H
+
+#include "EcsTypes.h"
+
+// Joueur courant : l'index est mis à jour après chaque refresh, ce qui évite de passer par
+// le handle à chaque accès dans les systèmes
+struct RPlayer {
+    ecs::Handle handle{};
+    ecs::EntityIndex index{};
+};
+
+#endif //RPLAYER_H
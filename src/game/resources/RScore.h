@@ -0,0 +1,12 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef RSCORE_H
+#define RSCORE_H
+
+struct RScore {
+    int value{0};
+};
+
+#endif //RSCORE_H
@@ -0,0 +1,19 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef RESOURCES_H
+#define RESOURCES_H
+
+#include "EcsTypes.h"
+#include "RPlayer.h"
+#include "RScore.h"
+#include "RHealth.h"
+
+using GameResourcesList = ecs::ResourceList<
+    RPlayer,
+    RScore,
+    RHealth
+>;
+
+#endif //RESOURCES_H
@@ -4,10 +4,21 @@
 
 #include "GameScene.h"
 
+#include <fstream>
+#include <optional>
+
 #include "Log.h"
+#include "physics/GridBroadphase.h"
 #include "physics/Physics.h"
 #include "scenes/MainMenuScene.h"
 
+// Fichier de sauvegarde rapide (snapshot binaire du monde)
+static const std::filesystem::path quick_save_path{"quicksave.bin"};
+
+// Nombre de frames conservées pour le retour arrière, et nombre de frames annulées par appui
+static constexpr std::size_t rollback_frame_count = 300;
+static constexpr std::size_t rewind_frame_count = 60;
+
 static std::string set_score_text(int score)
 {
     return std::format("Score: {}", score);
@@ -20,15 +31,17 @@ GameScene::GameScene(GameEngine &game)
       game_over_sound_{game_.getAssets().getSound("GAME_OVER"_sound)},
       kill_enemy_sound_{game_.getAssets().getSound("KILL_ENEMY"_sound)},
       spawn_enemy_sound_{game_.getAssets().getSound("SWEEP"_sound)},
-      health_{5}
+      bullet_broadphase_{2.f * game.configurationManager().getEnemySettings().collision_radius},
+      hierarchy_{entity_manager_},
+      rollback_{entity_manager_, rollback_frame_count}
 {
     ECS_CORE_TRACE("GameScene constructor");
 
     const auto &font_settings = game_.configurationManager().getFontSettings();
 
-    score_ = 0;
     score_text_ = sf::Text{
-        game.getAssets().getFont("DEFAULT"_font), set_score_text(score_), static_cast<unsigned>(font_settings.size)
+        game.getAssets().getFont("DEFAULT"_font), set_score_text(entity_manager_.resource<RScore>().value),
+        static_cast<unsigned>(font_settings.size)
     };
     score_text_.setFillColor({
         static_cast<std::uint8_t>(font_settings.color_r),
@@ -38,9 +51,19 @@ GameScene::GameScene(GameEngine &game)
     score_text_.setPosition({0.f, 0.f});
     current_frame_ = 0;
 
+    is_render_thread_ = game_.configurationManager().getGraphicsSettings().render_thread;
+    is_rewind_enabled_ = game_.configurationManager().getDebugSettings().rewind;
+    if (is_render_thread_)
+    {
+        is_gui_system_active = false;
+    }
+
+    // Score, sons et apparitions réagissent aux morts plutôt que d'être codés dans les collisions
+    entity_manager_.onKilled<&GameScene::onEntityKilled>(*this);
+
     spawnPlayer();
 
-    entity_manager_.refresh();
+    refreshEntities();
 
     game_.getAssets().getMusic("GAME_LOOP"_music).setLooping(true);
     game_.getAssets().getMusic("GAME_LOOP"_music).setVolume(20);
@@ -49,17 +72,138 @@ GameScene::GameScene(GameEngine &game)
 
 GameScene::~GameScene() = default;
 
+auto GameScene::refreshEntities() -> void
+{
+    entity_manager_.refresh();
+
+    // Le compactage peut déplacer le joueur : son index est résolu une seule fois ici
+    auto &player(entity_manager_.resource<RPlayer>());
+    player.index = entity_manager_.getEntityIndex(player.handle);
+}
+
+auto GameScene::quickSave() -> void
+{
+    std::vector<std::byte> snapshot;
+    entity_manager_.saveSnapshot(snapshot);
+
+    std::ofstream file(quick_save_path, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(snapshot.data()), static_cast<std::streamsize>(snapshot.size()));
+    if (!file)
+    {
+        ECS_CORE_ERROR("Unable to write quick save {}", quick_save_path.string());
+        return;
+    }
+
+    ECS_CORE_INFO("Quick save: {} entities, {} bytes", entity_manager_.getEntityCount(), snapshot.size());
+}
+
+auto GameScene::quickLoad() -> void
+{
+    std::ifstream file(quick_save_path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        ECS_CORE_WARN("No quick save to load");
+        return;
+    }
+
+    std::vector<std::byte> snapshot(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(snapshot.data()), static_cast<std::streamsize>(snapshot.size()));
+
+    if (!file || !entity_manager_.loadSnapshot(snapshot))
+    {
+        // Image rejetée ou tronquée : on repart d'une partie neuve
+        ECS_CORE_ERROR("Invalid quick save {}", quick_save_path.string());
+        entity_manager_.clear();
+        entity_manager_.resource<RScore>() = {};
+        entity_manager_.resource<RHealth>() = {};
+        spawnPlayer();
+        refreshEntities();
+    }
+
+    // L'historique décrit une autre partie
+    rollback_.clear();
+    onWorldRestored();
+}
+
+auto GameScene::rewind() -> void
+{
+    if (!is_rewind_enabled_)
+    {
+        ECS_CORE_WARN("Rewind is disabled (debug.rewind)");
+        return;
+    }
+
+    if (!rollback_.rollback(std::min(rewind_frame_count, rollback_.size())))
+    {
+        ECS_CORE_ERROR("Unable to rewind");
+        return;
+    }
+
+    onWorldRestored();
+}
+
+auto GameScene::onWorldRestored() -> void
+{
+    // Le monde a été remplacé : hiérarchie et rendu repartent de zéro
+    hierarchy_.reset();
+    hierarchy_tick_ = render_tick_ = ecs::ChangeTick{0u};
+    entity_manager_.resource<RPlayer>().index = entity_manager_.getEntityIndex(
+        entity_manager_.resource<RPlayer>().handle);
+}
+
+auto GameScene::onEntityKilled(EntityManager &entity_manager, const ecs::EntityIndex entity_index) -> void
+{
+    const bool destroyed = entity_manager.hasTag<TDestroyed>(entity_index);
+
+    if (entity_manager.hasTag<TEnemy>(entity_index) && destroyed)
+    {
+        entity_manager.resource<RScore>().value += entity_manager.getComponent<CScore>(entity_index).score;
+
+        if (!entity_manager.hasTag<TSmallEnemy>(entity_index))
+        {
+            spawnSmallEnemies(entity_index);
+        }
+        kill_enemy_sound_.play();
+    }
+
+    if (entity_manager.hasTag<TPlayer>(entity_index))
+    {
+        if (destroyed)
+        {
+            auto &health(entity_manager.resource<RHealth>());
+            health.value -= 1;
+            if (health.value <= 0)
+            {
+                game_over_sound_.play();
+                // TODO : GAME OVER
+                //game_.changeScene("GAME_OVER"_scene);
+                health.value = 5;
+            }
+            else
+            {
+                death_sound_.play();
+            }
+        }
+
+        spawnPlayer();
+    }
+}
+
 auto GameScene::spawnPlayer() -> void
 {
     const auto &player_settings = game_.configurationManager().getPlayerSettings();
-    player_entity_handle_ = entity_manager_.createHandle();
+    auto &player(entity_manager_.resource<RPlayer>());
+    player.handle = entity_manager_.createHandle();
+    player.index = entity_manager_.getEntityIndex(player.handle);
 
-    entity_manager_.addTag<TPlayer>(player_entity_handle_);
+    entity_manager_.addTag<TPlayer>(player.index);
 
-    auto &transform(entity_manager_.addComponent<CTransform>(player_entity_handle_));
-    auto &collision(entity_manager_.addComponent<CCollision>(player_entity_handle_));
-    auto &shape(entity_manager_.addComponent<CShape>(player_entity_handle_));
-    entity_manager_.addComponent<CInput>(player_entity_handle_);
+    auto &transform(entity_manager_.addComponent<CTransform>(player.index));
+    auto &collision(entity_manager_.addComponent<CCollision>(player.index));
+    auto &shape(entity_manager_.addComponent<CShape>(player.index));
+    entity_manager_.addComponent<CInput>(player.index);
+    tick_tiers_.init(entity_manager_.addComponent<ecs::CTickTier>(player.index));
 
     transform.position = {game_.windowSize().x / 2.f, game_.windowSize().y / 2.f}; // NOLINT(*-narrowing-conversions)
     transform.velocity = {};
@@ -86,14 +230,19 @@ auto GameScene::spawnEnemy() -> void
 {
     const auto &enemy_settings = game_.configurationManager().getEnemySettings();
 
-    const auto enemy_entity_index_ = entity_manager_.createIndex();
+    const auto enemy_handle = entity_manager_.createHandle();
+    const auto enemy_entity_index_ = entity_manager_.getEntityIndex(enemy_handle);
 
     entity_manager_.addTag<TEnemy>(enemy_entity_index_);
+    // L'ennemi (et ses boucliers) reste en attente jusqu'au prochain passage du spawner
+    entity_manager_.addTag<TSpawning>(enemy_entity_index_);
+    entity_manager_.setEnabled(enemy_entity_index_, false);
 
     auto &transform(entity_manager_.addComponent<CTransform>(enemy_entity_index_));
     auto &collision(entity_manager_.addComponent<CCollision>(enemy_entity_index_));
     auto &shape(entity_manager_.addComponent<CShape>(enemy_entity_index_));
     auto &score(entity_manager_.addComponent<CScore>(enemy_entity_index_));
+    tick_tiers_.init(entity_manager_.addComponent<ecs::CTickTier>(enemy_entity_index_));
 
     std::mt19937 gen(random_device_());
     std::uniform_real_distribution dis_x(0.f + enemy_settings.shape_radius,
@@ -128,13 +277,54 @@ auto GameScene::spawnEnemy() -> void
     shape.circle.setPointCount(static_cast<std::size_t>(dis_vertices(gen)));
 
     score.score = 100 * static_cast<int>(shape.circle.getPointCount());
+
+    spawnShields(enemy_handle);
+}
+
+auto GameScene::spawnShields(const ecs::Handle enemy) -> void
+{
+    const auto &enemy_settings = game_.configurationManager().getEnemySettings();
+    const auto enemy_fill_color(entity_manager_.getComponent<CShape>(enemy).circle.getFillColor());
+    const float distance = enemy_settings.shape_radius + 2.f * enemy_settings.shield_radius;
+
+    for (int i = 0; i < enemy_settings.shield_count; ++i)
+    {
+        const auto shield_handle = entity_manager_.createHandle();
+
+        auto &transform(entity_manager_.addComponent<CTransform>(shield_handle));
+        auto &local(entity_manager_.addComponent<CLocalTransform>(shield_handle));
+        auto &shape(entity_manager_.addComponent<CShape>(shield_handle));
+        tick_tiers_.init(entity_manager_.addComponent<ecs::CTickTier>(shield_handle));
+
+        entity_manager_.addTag<TSpawning>(shield_handle);
+        entity_manager_.setEnabled(shield_handle, false);
+
+        // Les boucliers sont répartis autour de l'ennemi et tournent avec lui
+        const float angle = 360.f * static_cast<float>(i) / static_cast<float>(enemy_settings.shield_count);
+        local.position = sf::Vector2f{distance, 0.f}.rotatedBy(sf::degrees(angle));
+        local.angle = angle;
+        transform.position = entity_manager_.getComponent<CTransform>(enemy).position + local.position;
+
+        shape.circle = sf::CircleShape(enemy_settings.shield_radius);
+        shape.circle.setOrigin({enemy_settings.shield_radius, enemy_settings.shield_radius});
+        shape.circle.setFillColor(enemy_fill_color);
+        shape.circle.setOutlineColor({
+            static_cast<std::uint8_t>(enemy_settings.outline_color_r),
+            static_cast<std::uint8_t>(enemy_settings.outline_color_g),
+            static_cast<std::uint8_t>(enemy_settings.outline_color_b)
+        });
+        shape.circle.setOutlineThickness(enemy_settings.outline_thickness);
+
+        hierarchy_.attach(shield_handle, enemy);
+    }
 }
 
-auto GameScene::spawnBullet(const ecs::Handle player_handle, const sf::Vector2f &target) -> void
+auto GameScene::spawnBullet(const ecs::EntityIndex player, const sf::Vector2f &target) -> void
 {
-    const auto &player_transform(entity_manager_.getComponent<CTransform>(player_handle));
+    // Copie de la position : la création d'entités peut réallouer les composants
+    const auto player_position(entity_manager_.getComponent<CTransform>(player).position);
 
-    const sf::Vector2f direction = (target - player_transform.position).normalized();
+    const sf::Vector2f direction = (target - player_position).normalized();
 
     const auto &bullet_settings = game_.configurationManager().getBulletSettings();
     const auto bullet_entity_index_ = entity_manager_.createIndex();
@@ -145,8 +335,9 @@ auto GameScene::spawnBullet(const ecs::Handle player_handle, const sf::Vector2f
     auto &collision(entity_manager_.addComponent<CCollision>(bullet_entity_index_));
     auto &shape(entity_manager_.addComponent<CShape>(bullet_entity_index_));
     auto &lifespan(entity_manager_.addComponent<CLifespan>(bullet_entity_index_));
+    tick_tiers_.init(entity_manager_.addComponent<ecs::CTickTier>(bullet_entity_index_));
 
-    transform.position = player_transform.position;
+    transform.position = player_position;
     transform.velocity = direction * bullet_settings.speed;
 
     collision.radius = bullet_settings.collision_radius;
@@ -171,13 +362,16 @@ auto GameScene::spawnBullet(const ecs::Handle player_handle, const sf::Vector2f
 
 auto GameScene::spawnSmallEnemies(const ecs::EntityIndex enemy) -> void
 {
-    const auto &enemy_shape(entity_manager_.getComponent<CShape>(enemy));
-    const auto &enemy_transform(entity_manager_.getComponent<CTransform>(enemy));
-    const auto &enemy_score(entity_manager_.getComponent<CScore>(enemy));
+    // Copie des données de l'ennemi : la création d'entités peut réallouer les composants
+    const auto enemy_position(entity_manager_.getComponent<CTransform>(enemy).position);
+    const auto enemy_velocity(entity_manager_.getComponent<CTransform>(enemy).velocity);
+    const auto enemy_fill_color(entity_manager_.getComponent<CShape>(enemy).circle.getFillColor());
+    const auto enemy_point_count(entity_manager_.getComponent<CShape>(enemy).circle.getPointCount());
+    const auto enemy_score(entity_manager_.getComponent<CScore>(enemy).score);
 
-    auto small_enemy_angle = enemy_transform.angle;
+    auto small_enemy_angle = entity_manager_.getComponent<CTransform>(enemy).angle;
 
-    for (std::size_t i = 0; i < enemy_shape.circle.getPointCount(); ++i)
+    for (std::size_t i = 0; i < enemy_point_count; ++i)
     {
         auto &enemy_settings = game_.configurationManager().getEnemySettings();
         const auto small_enemy_entity_index_ = entity_manager_.createIndex();
@@ -192,26 +386,27 @@ auto GameScene::spawnSmallEnemies(const ecs::EntityIndex enemy) -> void
         auto &shape(entity_manager_.addComponent<CShape>(small_enemy_entity_index_));
         auto &lifespan(entity_manager_.addComponent<CLifespan>(small_enemy_entity_index_));
         auto &score(entity_manager_.addComponent<CScore>(small_enemy_entity_index_));
+        tick_tiers_.init(entity_manager_.addComponent<ecs::CTickTier>(small_enemy_entity_index_));
 
-        transform.position = enemy_transform.position;
-        transform.velocity = enemy_transform.velocity.rotatedBy(sf::degrees(small_enemy_angle));
+        transform.position = enemy_position;
+        transform.velocity = enemy_velocity.rotatedBy(sf::degrees(small_enemy_angle));
 
         collision.radius = enemy_settings.collision_radius * 0.5f;
 
         shape.circle = sf::CircleShape(enemy_settings.shape_radius * 0.5f);
         shape.circle.setOrigin({enemy_settings.shape_radius * 0.5f, enemy_settings.shape_radius * 0.5f});
-        shape.circle.setFillColor(enemy_shape.circle.getFillColor());
+        shape.circle.setFillColor(enemy_fill_color);
         shape.circle.setOutlineColor({
             static_cast<std::uint8_t>(enemy_settings.outline_color_r),
             static_cast<std::uint8_t>(enemy_settings.outline_color_g),
             static_cast<std::uint8_t>(enemy_settings.outline_color_b)
         });
         shape.circle.setOutlineThickness(enemy_settings.outline_thickness);
-        shape.circle.setPointCount(enemy_shape.circle.getPointCount());
+        shape.circle.setPointCount(enemy_point_count);
 
         lifespan.lifespan = lifespan.remaining = enemy_settings.small_lifespan;
 
-        score.score = enemy_score.score * 2;
+        score.score = enemy_score * 2;
 
         small_enemy_angle += 360.f / static_cast<float>(shape.circle.getPointCount());
     }
@@ -221,28 +416,79 @@ auto GameScene::update(const sf::Time &delta_time, sf::RenderWindow &render_wind
 {
     ImGui::SFML::Update(render_window, delta_time);
 
-    sEnemySpawner();
-    sMovement(delta_time);
-    sCollision();
-    sUserInput(render_window);
-    sLifespan();
-    sGUI();
+    // Les requêtes de la frame précédente (rendu compris) deviennent celles affichées par l'onglet Stats
+    entity_manager_.endQueryFrame();
+
+    tick_tiers_.beginFrame(delta_time.asSeconds());
+
+    // L'ordre d'exécution est calculé à la compilation à partir des accès déclarés par chaque système
+    GameSettings::SystemSchedule::forEachSystem([&]<typename TSystem>() {
+        if constexpr (std::is_same_v<TSystem, EnemySpawnerSystem>) sEnemySpawner();
+        else if constexpr (std::is_same_v<TSystem, TickTierSystem>) sTickTiers();
+        else if constexpr (std::is_same_v<TSystem, MovementSystem>) sMovement();
+        else if constexpr (std::is_same_v<TSystem, HierarchySystem>) sHierarchy();
+        else if constexpr (std::is_same_v<TSystem, CollisionSystem>) sCollision();
+        else if constexpr (std::is_same_v<TSystem, UserInputSystem>) sUserInput(render_window);
+        else if constexpr (std::is_same_v<TSystem, LifespanSystem>) sLifespan();
+        else if constexpr (std::is_same_v<TSystem, GUISystem>) sGUI();
+    });
 
-    entity_manager_.refresh();
+    refreshEntities();
+
+    // Sauvegarde / chargement entre deux frames : aucun système n'est en cours d'itération
+    if (quick_save_requested_) quickSave();
+    if (quick_load_requested_) quickLoad();
+    if (rewind_requested_) rewind();
+    quick_save_requested_ = quick_load_requested_ = rewind_requested_ = false;
+
+    // Coût proportionnel à la taille du monde (voir ecs::Rollback) : uniquement si le retour arrière est activé
+    if (is_rewind_enabled_) rollback_.record();
 
-    render(render_window);
+    if (is_render_thread_)
+    {
+        // Pas de fenêtre de debug : la frame ImGui est close sans être dessinée
+        ImGui::EndFrame();
+    }
 
     current_frame_++;
 }
 
-auto GameScene::sMovement(const sf::Time delta_clock) -> void
+auto GameScene::sTickTiers() -> void
+{
+    // Distance au joueur au-delà de laquelle un ennemi passe au palier suivant (période doublée)
+    constexpr float tier_distance = 300.f;
+    // Les paliers n'ont pas besoin d'être tous recalculés à chaque frame : le parcours est
+    // interrompu une fois ce budget dépassé et repris à la frame suivante
+    constexpr std::chrono::microseconds tier_budget{100};
+
+    const auto player_position(entity_manager_.getComponent<CTransform>(entity_manager_.resource<RPlayer>().index).position);
+
+    entity_manager_.forEntitiesMatching<SEnemyTiers>(
+        tick_tier_cursor_, tier_budget,
+        [this, player_position](
+    [[maybe_unused]] const ecs::EntityIndex entity_index,
+    const CTransform &transform,
+    ecs::CTickTier &tick_tier) {
+            auto tier = std::uint8_t{0};
+            if (is_tick_tier_system_active)
+            {
+                const auto distance = (transform.position - player_position).length();
+                tier = static_cast<std::uint8_t>(std::min(distance / tier_distance,
+                                                          static_cast<float>(ecs::TickTiers::TierCount - 1)));
+            }
+            tick_tiers_.assign(tick_tier, tier);
+        });
+}
+
+auto GameScene::sMovement() -> void
 {
     if (!is_movements_system_active) return;
 
     const auto &player_settings = game_.configurationManager().getPlayerSettings();
 
-    auto &transform(entity_manager_.getComponent<CTransform>(player_entity_handle_));
-    auto &input(entity_manager_.getComponent<CInput>(player_entity_handle_));
+    const auto player_index(entity_manager_.resource<RPlayer>().index);
+    auto &transform(entity_manager_.getComponent<CTransform>(player_index));
+    auto &input(entity_manager_.getComponent<CInput>(player_index));
 
     sf::Vector2f direction;
 
@@ -276,25 +522,49 @@ auto GameScene::sMovement(const sf::Time delta_clock) -> void
     if (input.shoot)
     {
         input.shoot = false;
-        spawnBullet(player_entity_handle_, game_.mapPixelToCoords(input.shoot_position));
+        spawnBullet(player_index, game_.mapPixelToCoords(input.shoot_position));
         shoot_sound_.play();
     }
 
-    // On calcule les déplacements/mouvements des entités
-    entity_manager_.forEntitiesMatching<STransform>(
-        [delta_clock](
-    [[maybe_unused]] const ecs::EntityIndex entity_index,
-    CTransform &entity_transform) {
-            // Toutes les entités doivent tourner
-            entity_transform.angle += 60.f * delta_clock.asSeconds();
-            // Toutes les entités doivent se déplacer suivant leur vélocité
-            entity_transform.position += entity_transform.velocity * delta_clock.asSeconds();
+    // On calcule les déplacements/mouvements des entités, par blocs contigus de composants.
+    // Seules les entités dues à cette frame sont déplacées, du temps écoulé depuis leur dernière mise à jour
+    entity_manager_.forChunksMatching<STransform>(
+        [this](
+    const ecs::EntityIndex first_entity_index,
+    const std::span<CTransform> transforms,
+    const std::span<ecs::CTickTier> tick_tiers) {
+            for (std::size_t i = 0; i < transforms.size(); ++i)
+            {
+                if (!tick_tiers_.isDue(tick_tiers[i])) continue;
+
+                auto &entity_transform = transforms[i];
+                const float delta_seconds = tick_tiers_.consume(tick_tiers[i]);
+                // Toutes les entités doivent tourner
+                entity_transform.angle += 60.f * delta_seconds;
+                // Toutes les entités doivent se déplacer suivant leur vélocité
+                entity_transform.position += entity_transform.velocity * delta_seconds;
+            }
+            entity_manager_.markChanged<CTransform>(first_entity_index, transforms.size());
+        });
+}
+
+auto GameScene::sHierarchy() -> void
+{
+    if (!is_hierarchy_system_active) return;
+
+    // Balayage linéaire par profondeur : seuls les sous-arbres modifiés sont recalculés
+    hierarchy_.propagate<CLocalTransform, CTransform>(
+        hierarchy_tick_,
+        [](const CTransform &parent, const CLocalTransform &local, CTransform &world) {
+            world.position = parent.position + local.position.rotatedBy(sf::degrees(parent.angle));
+            world.velocity = parent.velocity;
+            world.angle = parent.angle + local.angle;
         });
 }
 
 auto GameScene::sUserInput(sf::Window &window) -> void
 {
-    auto &user_input(entity_manager_.getComponent<CInput>(player_entity_handle_));
+    auto &user_input(entity_manager_.getComponent<CInput>(entity_manager_.resource<RPlayer>().index));
 
     window.handleEvents(
         [&](const sf::Event::Closed &closed) {
@@ -338,6 +608,18 @@ auto GameScene::sUserInput(sf::Window &window) -> void
             {
                 user_input.right = true;
             }
+            if (key_pressed.code == sf::Keyboard::Key::F5)
+            {
+                quick_save_requested_ = true;
+            }
+            if (key_pressed.code == sf::Keyboard::Key::F9)
+            {
+                quick_load_requested_ = true;
+            }
+            if (key_pressed.code == sf::Keyboard::Key::Backspace)
+            {
+                rewind_requested_ = true;
+            }
         },
         [&](const sf::Event::KeyReleased &key_released) {
             ImGui::SFML::ProcessEvent(window, key_released);
@@ -374,6 +656,13 @@ auto GameScene::sUserInput(sf::Window &window) -> void
 
 auto GameScene::sEnemySpawner() -> void
 {
+    // Les entités créées depuis le dernier passage (spawner ou apparition manuelle) apparaissent ensemble
+    entity_manager_.forDisabledMatching<SSpawning>([this](const ecs::EntityIndex entity_index)
+    {
+        entity_manager_.delTag<TSpawning>(entity_index);
+        entity_manager_.setEnabled(entity_index, true);
+    });
+
     if (!is_enemy_spawning_system_active) return;
 
     const auto &enemy_settings = game_.configurationManager().getEnemySettings();
@@ -390,21 +679,21 @@ auto GameScene::sLifespan() -> void
 {
     if (!is_lifespan_system_active) return;
 
+    // Les entités dont la durée de vie est écoulée sont tuées en une passe
+    entity_manager_.killIf<SLifespan>([](const CLifespan &lifespan, const CShape &) {
+        return lifespan.remaining <= 1;
+    });
+
     entity_manager_.forEntitiesMatching<SLifespan>(
-        [this](
-    const ecs::EntityIndex entity_index,
-    CLifespan &lifespan,
-    CShape &shape
-) {
+        []([[maybe_unused]] const ecs::EntityIndex entity_index, CLifespan &lifespan, CShape &shape) {
             lifespan.remaining -= 1;
-            if (lifespan.remaining <= 0)
-            {
-                entity_manager_.kill(entity_index);
-            }
-            else
+            if (lifespan.remaining <= 0) return;
+
+            const auto &fill_color = shape.circle.getFillColor();
+            const auto alpha = static_cast<unsigned char>((255 * lifespan.remaining) / lifespan.lifespan);
+            // La forme n'est modifiée que si la transparence change réellement
+            if (alpha != fill_color.a)
             {
-                const auto &fill_color = shape.circle.getFillColor();
-                const auto alpha = static_cast<unsigned char>((255 * lifespan.remaining) / lifespan.lifespan);
                 shape.circle.setFillColor(sf::Color{fill_color.r, fill_color.g, fill_color.b, alpha});
             }
         });
@@ -414,13 +703,38 @@ auto GameScene::sCollision() -> void
 {
     if (!is_collision_system_active) return;
 
-    auto &player_transform(entity_manager_.getComponent<CTransform>(player_entity_handle_));
-    auto &player_collision(entity_manager_.getComponent<CCollision>(player_entity_handle_));
+    const auto player_index(entity_manager_.resource<RPlayer>().index);
+    auto &player_transform(entity_manager_.getComponent<CTransform>(player_index));
+    auto &player_collision(entity_manager_.getComponent<CCollision>(player_index));
 
     // Les balles percutent-elles les ennemis ?
-    // Pour chaque ennemi
-    entity_manager_.forEntitiesMatching<SEnemies>(
-        [this, &player_transform, &player_collision](
+    // La grille ne propose que les couples (ennemi, balle) proches
+    entity_manager_.forPairsMatching<SEnemies, SBullets>(
+        [this](
+    const ecs::EntityIndex enemy_entity_index,
+    const CTransform &enemy_transform,
+    const CCollision &enemy_collision,
+    [[maybe_unused]] const CShape &enemy_shape,
+    [[maybe_unused]] const CScore &enemy_score,
+    const ecs::EntityIndex bullet_entity_index,
+    const CTransform &bullet_transform,
+    const CCollision &bullet_collision,
+    [[maybe_unused]] const CShape &bullet_shape,
+    [[maybe_unused]] const CLifespan &bullet_lifespan
+) {
+            if (Physics::isCollision(enemy_transform.position, bullet_transform.position,
+                                     enemy_collision.radius, bullet_collision.radius))
+            {
+                // Score, sons et petits ennemis sont gérés par onEntityKilled
+                entity_manager_.addTag<TDestroyed>(enemy_entity_index);
+                entity_manager_.kill(enemy_entity_index);
+                entity_manager_.kill(bullet_entity_index);
+            }
+        }, bullet_broadphase_);
+
+    // Les ennemis percutent-ils le joueur ?
+    entity_manager_.forGroup<SEnemies>(
+        [this, player_index, &player_transform, &player_collision](
     [[maybe_unused]] const ecs::EntityIndex enemy_entity_index,
     [[maybe_unused]] const CTransform &enemy_transform,
     [[maybe_unused]] const CCollision &enemy_collision,
@@ -428,58 +742,17 @@ auto GameScene::sCollision() -> void
     [[maybe_unused]] const CScore &enemy_score
 ) {
             if (!entity_manager_.isAlive(enemy_entity_index)) return;
-            entity_manager_.forEntitiesMatching<SBullets>(
-                [this, &enemy_transform, &enemy_score, &enemy_entity_index, &enemy_collision](
-            [[maybe_unused]] const ecs::EntityIndex bullet_entity_index,
-            [[maybe_unused]] const CTransform &bullet_transform,
-            [[maybe_unused]] const CCollision &bullet_collision,
-            [[maybe_unused]] const CShape &bullet_shape,
-            [[maybe_unused]] const CLifespan &bullet_lifespan
-        ) {
-                    if (!entity_manager_.isAlive(bullet_entity_index)) return;
-                    if (Physics::isCollision(enemy_transform.position, bullet_transform.position,
-                                             enemy_collision.radius, bullet_collision.radius))
-                    {
-                        score_ += enemy_score.score;
-
-                        if (!entity_manager_.hasTag<TSmallEnemy>(enemy_entity_index))
-                        {
-                            spawnSmallEnemies(enemy_entity_index);
-                        }
-                        entity_manager_.kill(enemy_entity_index);
-                        entity_manager_.kill(bullet_entity_index);
-                        kill_enemy_sound_.play();
-                    }
-                });
 
-            if (!entity_manager_.isAlive(enemy_entity_index)) return;
-
-            if (!entity_manager_.isAlive(player_entity_handle_)) return;
+            if (!entity_manager_.isAlive(player_index)) return;
 
             if (Physics::isCollision(enemy_transform.position, player_transform.position, enemy_collision.radius,
                                      player_collision.radius))
             {
-                if (!entity_manager_.hasTag<TSmallEnemy>(enemy_entity_index))
-                {
-                    spawnSmallEnemies(enemy_entity_index);
-                }
+                // La perte de vie et la réapparition du joueur sont gérées par onEntityKilled
+                entity_manager_.addTag<TDestroyed>(enemy_entity_index);
+                entity_manager_.addTag<TDestroyed>(player_index);
                 entity_manager_.kill(enemy_entity_index);
-                entity_manager_.kill(player_entity_handle_);
-
-                health_ -= 1;
-                if (health_ <= 0)
-                {
-                    game_over_sound_.play();
-                    // TODO : GAME OVER
-                    //game_.changeScene("GAME_OVER"_scene);
-                    health_ = 5;
-                }
-                else
-                {
-                    death_sound_.play();
-                }
-
-                spawnPlayer();
+                entity_manager_.kill(player_index);
             }
         });
 
@@ -502,7 +775,7 @@ auto GameScene::sCollision() -> void
     }
 
     // The enemies cannot cross window and bounce in the opposite way
-    entity_manager_.forEntitiesMatching<SEnemies>(
+    entity_manager_.forGroup<SEnemies>(
         [this](
     [[maybe_unused]] const ecs::EntityIndex entity_index,
     [[maybe_unused]] CTransform &transform,
@@ -533,40 +806,82 @@ auto GameScene::sCollision() -> void
         });
 }
 
+auto GameScene::extractRenderState() -> void
+{
+    auto &state(render_state_.back());
+
+    state.is_render_system_active = is_render_system_active;
+    state.health = entity_manager_.resource<RHealth>().value;
+    state.score = entity_manager_.resource<RScore>().value;
+    state.shape_count = 0;
+
+    if (!is_render_system_active) return;
+
+    // Seules les formes dont la transformation a changé depuis la dernière extraction sont synchronisées
+    entity_manager_.forEntitiesMatching<SRendering, ecs::Changed<CTransform>>(
+        render_tick_,
+        []([[maybe_unused]] const ecs::EntityIndex entity_index, const CTransform &transform, CShape &shape) {
+            shape.circle.setPosition(transform.position);
+            shape.circle.setRotation(sf::degrees(transform.angle));
+        });
+
+    // Les formes sont réaffectées en place : les tampons ne réallouent pas d'une frame à l'autre
+    entity_manager_.forGroup<SRendering>(
+        [&state]([[maybe_unused]] const ecs::EntityIndex entity_index,
+                 [[maybe_unused]] const CTransform &transform, const CShape &shape) {
+            if (state.shape_count == state.shapes.size())
+            {
+                state.shapes.push_back(shape.circle);
+            }
+            else
+            {
+                state.shapes[state.shape_count] = shape.circle;
+            }
+            ++state.shape_count;
+        });
+}
+
+auto GameScene::swapRenderState() -> void
+{
+    render_state_.swap();
+}
+
 auto GameScene::render(sf::RenderTarget &render_target) -> void
 {
     //shader_.setUniform("u_resolution", sf::Glsl::Vec2{ window_.getSize() });
     //shader_.setUniform("u_mouse", sf::Glsl::Vec2{ mouse_position });
     //shader_.setUniform("u_time", delta_clock.asSeconds());
 
-    if (is_render_system_active)
-    {
-        entity_manager_.forEntitiesMatching<SRendering>(
-            [&render_target]([[maybe_unused]] const ecs::EntityIndex entity_index, const CTransform &transform,
-                             CShape &shape) {
-                shape.circle.setPosition(transform.position);
-                shape.circle.setRotation(sf::degrees(transform.angle));
+    // Seul l'état publié est lu : la simulation peut produire la frame suivante en parallèle
+    const auto &state(render_state_.front());
 
-                //shader_.setUniform("u_color", sf::Glsl::Vec4{shape.circle.getFillColor()});
-                //render_target.draw(shape.circle, &shader_);
-                render_target.draw(shape.circle);
-            });
+    if (state.is_render_system_active)
+    {
+        for (std::size_t i = 0; i < state.shape_count; i++)
+        {
+            //shader_.setUniform("u_color", sf::Glsl::Vec4{shape.circle.getFillColor()});
+            //render_target.draw(shape.circle, &shader_);
+            render_target.draw(state.shapes[i]);
+        }
 
         // Render hearts
         auto heart = sf::Sprite(game_.getAssets().getTexture("HEART"_texture)); // TODO : On peut faire bien mieux...
-        for (auto i = 0; i < health_; i++)
+        for (auto i = 0; i < state.health; i++)
         {
             heart.setPosition({50.f * static_cast<float>(i), 0.f});
             render_target.draw(heart);
         }
 
         score_text_.setPosition({0, 50});
-        score_text_.setString(set_score_text(score_));
+        score_text_.setString(set_score_text(state.score));
 
         render_target.draw(score_text_);
     }
 
-    ImGui::SFML::Render(render_target);
+    if (!is_render_thread_)
+    {
+        ImGui::SFML::Render(render_target);
+    }
 }
 
 auto GameScene::sGUI() -> void
@@ -575,6 +890,9 @@ auto GameScene::sGUI() -> void
 
     auto &enemy_settings = game_.configurationManager().getEnemySettings();
 
+    // Entité désignée par un bouton "D" : tuée après les parcours, sans refresh au milieu d'une requête
+    std::optional<ecs::EntityIndex> kill_target;
+
     ImGui::Begin("Geometry Wars");
     ImGui::Text("Nombre d'entités : %lu", entity_manager_.getEntityCount());
 
@@ -585,6 +903,8 @@ auto GameScene::sGUI() -> void
         {
             ImGui::Text("Systems tab\nPermet de désactiver les systèmes du jeu");
             ImGui::Checkbox("Movements", &is_movements_system_active);
+            ImGui::Checkbox("Hierarchy", &is_hierarchy_system_active);
+            ImGui::Checkbox("Tick tiers", &is_tick_tier_system_active);
             ImGui::Checkbox("Lifespan", &is_lifespan_system_active);
             ImGui::Checkbox("Collision", &is_collision_system_active);
             ImGui::Checkbox("Spawning", &is_enemy_spawning_system_active);
@@ -597,6 +917,11 @@ auto GameScene::sGUI() -> void
             ImGui::Unindent();
             ImGui::Checkbox("GUI", &is_gui_system_active);
             ImGui::Checkbox("Rendering", &is_render_system_active);
+            // L'historique ne couvre que des frames consécutives : il repart de zéro à chaque bascule
+            if (ImGui::Checkbox("Rewind", &is_rewind_enabled_))
+            {
+                rollback_.clear();
+            }
             ImGui::EndTabItem();
         }
         if (ImGui::BeginTabItem("Entities"))
@@ -610,16 +935,17 @@ auto GameScene::sGUI() -> void
                 {
                     ImGui::Indent();
                     entity_manager_.forEntitiesMatching<SBullets>(
-                        [this]([[maybe_unused]] const ecs::EntityIndex entity_index,
-                               [[maybe_unused]] const CTransform &transform, [[maybe_unused]] CCollision &collision,
-                               [[maybe_unused]] const CShape &shape, [[maybe_unused]] const CLifespan &lifespan) {
+                        [this, &kill_target]([[maybe_unused]] const ecs::EntityIndex entity_index,
+                                             [[maybe_unused]] const CTransform &transform,
+                                             [[maybe_unused]] CCollision &collision,
+                                             [[maybe_unused]] const CShape &shape,
+                                             [[maybe_unused]] const CLifespan &lifespan) {
                             ImGui::PushID(0);
                             ImGui::PushStyleColor(ImGuiCol_Button,
                                                   static_cast<ImVec4>(ImColor(shape.circle.getFillColor())));
                             if (ImGui::Button(std::format("D##{}", entity_index.get()).c_str()))
                             {
-                                this->entity_manager_.kill(entity_index);
-                                entity_manager_.refresh();
+                                kill_target = entity_index;
                             }
                             ImGui::PopStyleColor(1);
                             ImGui::PopID();
@@ -635,11 +961,11 @@ auto GameScene::sGUI() -> void
                 {
                     ImGui::Indent();
                     entity_manager_.forEntitiesMatching<SEnemies>(
-                        [this]([[maybe_unused]] const ecs::EntityIndex entity_index,
-                               [[maybe_unused]] const CTransform &transform,
-                               [[maybe_unused]] const CCollision &collision,
-                               [[maybe_unused]] const CShape &shape,
-                               [[maybe_unused]] const CScore &score) {
+                        [this, &kill_target]([[maybe_unused]] const ecs::EntityIndex entity_index,
+                                             [[maybe_unused]] const CTransform &transform,
+                                             [[maybe_unused]] const CCollision &collision,
+                                             [[maybe_unused]] const CShape &shape,
+                                             [[maybe_unused]] const CScore &score) {
                             if (entity_manager_.hasTag<TSmallEnemy>(entity_index)) return;
 
                             ImGui::PushID(0);
@@ -647,8 +973,7 @@ auto GameScene::sGUI() -> void
                                                   static_cast<ImVec4>(ImColor(shape.circle.getFillColor())));
                             if (ImGui::Button(std::format("D##{}", entity_index.get()).c_str()))
                             {
-                                this->entity_manager_.kill(entity_index);
-                                entity_manager_.refresh();
+                                kill_target = entity_index;
                             }
                             ImGui::PopStyleColor(1);
                             ImGui::PopID();
@@ -664,16 +989,15 @@ auto GameScene::sGUI() -> void
                 {
                     ImGui::Indent();
                     entity_manager_.forEntitiesMatching<SPlayers>(
-                        [this]([[maybe_unused]] const ecs::EntityIndex entity_index,
-                               [[maybe_unused]] const CTransform &transform,
-                               [[maybe_unused]] const CShape &shape) {
+                        [this, &kill_target]([[maybe_unused]] const ecs::EntityIndex entity_index,
+                                             [[maybe_unused]] const CTransform &transform,
+                                             [[maybe_unused]] const CShape &shape) {
                             ImGui::PushID(0);
                             ImGui::PushStyleColor(ImGuiCol_Button,
                                                   static_cast<ImVec4>(ImColor(shape.circle.getFillColor())));
                             if (ImGui::Button(std::format("D##{}", entity_index.get()).c_str()))
                             {
-                                this->entity_manager_.kill(entity_index);
-                                entity_manager_.refresh();
+                                kill_target = entity_index;
                             }
                             ImGui::PopStyleColor(1);
                             ImGui::PopID();
@@ -689,17 +1013,16 @@ auto GameScene::sGUI() -> void
                 {
                     ImGui::Indent();
                     entity_manager_.forEntitiesMatching<SSmallEnemies>(
-                        [this]([[maybe_unused]] const ecs::EntityIndex entity_index,
-                               [[maybe_unused]] const CTransform &transform,
-                               [[maybe_unused]] const CShape &shape,
-                               [[maybe_unused]] const CLifespan &lifespan) {
+                        [this, &kill_target]([[maybe_unused]] const ecs::EntityIndex entity_index,
+                                             [[maybe_unused]] const CTransform &transform,
+                                             [[maybe_unused]] const CShape &shape,
+                                             [[maybe_unused]] const CLifespan &lifespan) {
                             ImGui::PushID(0);
                             ImGui::PushStyleColor(ImGuiCol_Button,
                                                   static_cast<ImVec4>(ImColor(shape.circle.getFillColor())));
                             if (ImGui::Button(std::format("D##{}", entity_index.get()).c_str()))
                             {
-                                this->entity_manager_.kill(entity_index);
-                                entity_manager_.refresh();
+                                kill_target = entity_index;
                             }
                             ImGui::PopStyleColor(1);
                             ImGui::PopID();
@@ -715,11 +1038,74 @@ auto GameScene::sGUI() -> void
 
             ImGui::EndTabItem();
         }
+        if (ImGui::BeginTabItem("Stats"))
+        {
+            // Échantillonné à chaque frame tant que l'onglet est ouvert (un parcours des entités, sans allocation)
+            const auto stats = entity_manager_.stats();
+
+            memory_history_[memory_history_offset_] = static_cast<float>(stats.totalBytes()) / 1024.f;
+            memory_history_offset_ = (memory_history_offset_ + 1) % memory_history_.size();
+
+            ImGui::Text("Entités : %zu vivantes / %zu allouées (%zu agrandissements)", stats.size, stats.capacity,
+                        stats.growthCount);
+            ImGui::Text("Mémoire : %.1f Kio", static_cast<double>(stats.totalBytes()) / 1024.0);
+            ImGui::PlotLines("Kio", memory_history_.data(), static_cast<int>(memory_history_.size()),
+                             static_cast<int>(memory_history_offset_));
+            ImGui::Text("Table des entités : %zu o, table des handles : %zu o", stats.entityTableBytes,
+                        stats.handleTableBytes);
+            ImGui::Text("Index des tags : %zu o", stats.tagIndexBytes);
+            ImGui::Text("Fragmentation : %.1f %%", stats.fragmentation() * 100.0);
+            ImGui::Text("Entités désactivées : %zu", stats.disabled);
+
+            if (ImGui::CollapsingHeader("Components"))
+            {
+                for (const auto &column: stats.columns)
+                {
+                    ImGui::BulletText("%.*s : %zu / %zu (%zu o)", static_cast<int>(column.name.size()),
+                                      column.name.data(), column.occupied, stats.capacity, column.allocatedBytes);
+                }
+            }
+
+            if (ImGui::CollapsingHeader("Signatures"))
+            {
+                ecs::tools::for_each_type<GameSignaturesList>([&stats]<typename TSignature>() {
+                    const auto name = ecs::tools::type_name<TSignature>();
+                    ImGui::BulletText("%.*s : %zu", static_cast<int>(name.size()), name.data(),
+                                      stats.signatureMatches[static_cast<std::size_t>(GameSettings::signatureID<TSignature>())]);
+                });
+            }
+
+            if (ImGui::CollapsingHeader("Queries"))
+            {
+                if constexpr (!ecs::QueryStatsEnabled)
+                {
+                    ImGui::TextUnformatted("Instrumentation non compilée (option CMake ECS_QUERY_STATS)");
+                }
+                else
+                {
+                    // Par signature, sur la frame précédente : appels, entités retenues / visitées, durée
+                    const auto &queries = entity_manager_.queryStats();
+                    ecs::tools::for_each_type<GameSignaturesList>([&queries]<typename TSignature>() {
+                        const auto name = ecs::tools::type_name<TSignature>();
+                        const auto &query = queries[static_cast<std::size_t>(GameSettings::signatureID<TSignature>())];
+                        ImGui::BulletText("%.*s : %zu appels, %zu / %zu (%.1f %%), %.1f µs",
+                                          static_cast<int>(name.size()), name.data(), query.calls, query.matched,
+                                          query.visited, query.selectivity() * 100.0,
+                                          static_cast<double>(query.nanoseconds) / 1000.0);
+                    });
+                }
+            }
+
+            ImGui::EndTabItem();
+        }
         ImGui::EndTabBar();
     }
 
     ImGui::End();
 
+    // Aucun index n'a bougé depuis le parcours : le refresh de fin de frame (update) notifie les observateurs
+    if (kill_target) entity_manager_.kill(*kill_target);
+
     // Just for watching ImGui possibilities
     //ImGui::ShowDemoWindow();
 }
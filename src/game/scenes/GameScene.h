@@ -8,10 +8,20 @@
 #include "pch.h"
 
 #include "Scene.h"
+#include "physics/GridBroadphase.h"
+#include "tools/DoubleBuffer.h"
 
 class GameScene final
         : public Scene {
-    ecs::Handle player_entity_handle_{};
+    /// @brief État nécessaire au rendu d'une frame, copié depuis l'ECS en fin de simulation
+    struct RenderState {
+        std::vector<sf::CircleShape> shapes;
+        std::size_t shape_count = 0;
+        int health = 0;
+        int score = 0;
+        bool is_render_system_active = true;
+    };
+
     sf::Text score_text_;
     // Seed for random number
     std::random_device random_device_;
@@ -21,20 +31,58 @@ class GameScene final
     sf::Sound kill_enemy_sound_;
     sf::Sound spawn_enemy_sound_;
 
-    int score_;
-    int health_;
+    // Broadphase utilisé pour les collisions ennemis / balles
+    GridBroadphase bullet_broadphase_;
+
+    // Tick de la dernière extraction (synchronisation des formes avec les CTransform modifiés)
+    ecs::ChangeTick render_tick_{0u};
+
+    // Simulation en écriture, rendu en lecture (éventuellement depuis le thread de rendu)
+    tools::DoubleBuffer<RenderState> render_state_;
+
+    // Rendu dans un thread dédié : ImGui n'y est pas utilisable, la fenêtre de debug est désactivée
+    bool is_render_thread_ = false;
+
+    // Historique de la mémoire occupée par l'ECS (onglet Stats, en Kio)
+    std::array<float, 120> memory_history_{};
+    std::size_t memory_history_offset_ = 0;
+
+    // Relations parent/enfant (boucliers des ennemis) et tick de la dernière propagation
+    ecs::Hierarchy<EntityManager> hierarchy_;
+    ecs::ChangeTick hierarchy_tick_{0u};
+
+    // Paliers de fréquence de mise à jour (ennemis éloignés du joueur mis à jour moins souvent)
+    ecs::TickTiers tick_tiers_;
+    // Reprise du recalcul des paliers, étalé sur plusieurs frames
+    ecs::QueryCursor tick_tier_cursor_;
+
+    // Historique des dernières frames (retour arrière avec Retour arrière / Backspace)
+    ecs::Rollback<EntityManager> rollback_;
+    // Enregistrement de l'historique (debug.rewind) : un snapshot complet du monde par frame
+    bool is_rewind_enabled_ = false;
 
     bool is_movements_system_active = true;
+    bool is_hierarchy_system_active = true;
+    bool is_tick_tier_system_active = true;
     bool is_lifespan_system_active = true;
     bool is_collision_system_active = true;
     bool is_enemy_spawning_system_active = true;
     bool is_gui_system_active = true;
     bool is_render_system_active = true;
 
+    // Sauvegarde / chargement rapide demandés (F5 / F9), traités en fin de frame
+    bool quick_save_requested_ = false;
+    bool quick_load_requested_ = false;
+    bool rewind_requested_ = false;
+
     sf::Shader shader_;
 
     // Fonctions système
-    auto sMovement(sf::Time delta_clock) -> void;
+    auto sTickTiers() -> void;
+
+    auto sMovement() -> void;
+
+    auto sHierarchy() -> void;
 
     // TODO : sUserInput devrait être dans Scene.h. Ici, on devrait avoir un sDoAction(action)
     auto sUserInput(sf::Window &window) -> void;
@@ -48,14 +96,29 @@ class GameScene final
     auto sCollision() -> void;
 
     // Fonctions internes
+    auto refreshEntities() -> void;
+
+    auto quickSave() -> void;
+
+    auto quickLoad() -> void;
+
+    auto rewind() -> void;
+
+    auto onWorldRestored() -> void;
+
     auto spawnPlayer() -> void;
 
     auto spawnEnemy() -> void;
 
-    auto spawnBullet(ecs::Handle player_handle, const sf::Vector2f &target) -> void;
+    auto spawnShields(ecs::Handle enemy) -> void;
+
+    auto spawnBullet(ecs::EntityIndex player, const sf::Vector2f &target) -> void;
 
     auto spawnSmallEnemies(ecs::EntityIndex enemy) -> void;
 
+    // Observateurs ECS (notifiés au refresh)
+    auto onEntityKilled(EntityManager &entity_manager, ecs::EntityIndex entity_index) -> void;
+
 public:
     explicit GameScene(GameEngine &game);
 
@@ -65,6 +128,10 @@ public:
 
     // TODO : A priori en privé ça serait mieux
     auto render(sf::RenderTarget &render_target) -> void override;
+
+    auto extractRenderState() -> void override;
+
+    auto swapRenderState() -> void override;
 };
 
 #endif //GAME_SCENE_H
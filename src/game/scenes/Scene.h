@@ -42,8 +42,21 @@ public:
 
     // TODO : On devrait avoir une fonction void doAction(action) = 0
 
+    /// @brief Dessine la scène à partir du dernier état publié (peut être appelée depuis le thread de rendu)
     virtual auto render(sf::RenderTarget &render_target) -> void = 0;
 
+    /// @brief Copie l'état nécessaire au rendu dans le tampon d'écriture (thread de simulation)
+    virtual auto extractRenderState() -> void {}
+
+    /// @brief Publie le tampon d'écriture ; appelée lorsque render() n'est pas en cours
+    virtual auto swapRenderState() -> void {}
+
+    /// @brief Extraction puis publication, pour un rendu dans le même thread
+    auto publishRenderState() -> void {
+        extractRenderState();
+        swapRenderState();
+    }
+
     [[nodiscard]] auto hasEnded() const -> bool;
 };
 
@@ -12,10 +12,14 @@
 using SPlayers = ecs::Signature<TPlayer, CTransform, CShape>;
 using SBullets = ecs::Signature<TBullet, CTransform, CCollision, CShape, CLifespan>;
 using SEnemies = ecs::Signature<TEnemy, CTransform, CCollision, CShape, CScore>;
-using STransform = ecs::Signature<CTransform>;
+// Entités mobiles, mises à jour suivant leur palier de fréquence (voir ecs::TickTiers)
+using STransform = ecs::Signature<CTransform, ecs::CTickTier>;
+using SEnemyTiers = ecs::Signature<TEnemy, CTransform, ecs::CTickTier>;
 using SRendering = ecs::Signature<CTransform, CShape>;
 using SLifespan = ecs::Signature<CLifespan, CShape>;
 using SSmallEnemies = ecs::Signature<TSmallEnemy, CTransform, CShape, CLifespan>;
+// Entités créées désactivées, en attente d'apparition
+using SSpawning = ecs::Signature<TSpawning>;
 
 using GameSignaturesList = ecs::SignatureList<
     SPlayers,
@@ -24,7 +28,16 @@ using GameSignaturesList = ecs::SignatureList<
     STransform,
     SRendering,
     SLifespan,
-    SSmallEnemies
+    SSmallEnemies,
+    SSpawning,
+    SEnemyTiers
+>;
+
+// Groupes possédants, du plus large au plus restrictif : leurs membres occupent le début des
+// colonnes de composants (parcours par forGroup, sans indirection)
+using GameGroupsList = ecs::GroupList<
+    SRendering,
+    SEnemies
 >;
 
 #endif //SIGNATURES_H
@@ -0,0 +1,70 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef SYSTEMS_H
+#define SYSTEMS_H
+
+#include "EcsTypes.h"
+#include "components/Components.h"
+#include "resources/Resources.h"
+
+// Déclaration des accès de chaque système de GameScene.
+// Les systèmes qui créent, tuent, activent ou étiquettent des entités écrivent ecs::Entities, et
+// ceux qui en créent (spawn) écrivent aussi tous les composants qu'ils initialisent.
+
+struct EnemySpawnerSystem : ecs::System<
+            ecs::Reads<>,
+            ecs::Writes<ecs::Entities, CTransform, CCollision, CShape, CScore, CLocalTransform, ecs::CHierarchy,
+                        ecs::CTickTier>
+        > {};
+
+struct TickTierSystem : ecs::System<
+            ecs::Reads<RPlayer, CTransform>,
+            ecs::Writes<ecs::CTickTier>
+        > {};
+
+struct MovementSystem : ecs::System<
+            ecs::Reads<RPlayer>,
+            ecs::Writes<ecs::Entities, CInput, CTransform, CCollision, CShape, CLifespan, ecs::CTickTier>
+        > {};
+
+struct HierarchySystem : ecs::System<
+            ecs::Reads<CLocalTransform, ecs::CHierarchy>,
+            ecs::Writes<CTransform>
+        > {};
+
+struct CollisionSystem : ecs::System<
+            ecs::Reads<RPlayer>,
+            ecs::Writes<ecs::Entities, CTransform, CCollision, CShape, CLifespan, CScore, CInput, ecs::CTickTier>
+        > {};
+
+struct UserInputSystem : ecs::System<
+            ecs::Reads<RPlayer>,
+            ecs::Writes<CInput>
+        > {};
+
+struct LifespanSystem : ecs::System<
+            ecs::Reads<>,
+            ecs::Writes<ecs::Entities, CLifespan, CShape>
+        > {};
+
+// Création d'ennemis, kills et refresh depuis l'interface (les observateurs de kill modifient le score)
+struct GUISystem : ecs::System<
+            ecs::Reads<>,
+            ecs::Writes<ecs::Entities, CTransform, CCollision, CShape, CLifespan, CScore, CLocalTransform,
+                        ecs::CHierarchy, ecs::CTickTier, RScore>
+        > {};
+
+using GameSystemsList = ecs::SystemList<
+    EnemySpawnerSystem,
+    TickTierSystem,
+    MovementSystem,
+    HierarchySystem,
+    CollisionSystem,
+    UserInputSystem,
+    LifespanSystem,
+    GUISystem
+>;
+
+#endif //SYSTEMS_H
@@ -12,13 +12,16 @@ struct TBullet {};
 struct TEnemy {};
 struct TSmallEnemy {};
 struct TSpawning {};
+// Entité détruite par une collision (et non retirée par le debug ou la durée de vie)
+struct TDestroyed {};
 
 using GameTagsList = ecs::TagList<
     TPlayer,
     TBullet,
     TEnemy,
     TSmallEnemy,
-    TSpawning
+    TSpawning,
+    TDestroyed
 >;
 
 #endif //TAGS_H
@@ -48,6 +48,7 @@ namespace tools {
         configuration_.lookupValue("graphics.attribute_flags", graphics_settings_.attribute_flags);
         configuration_.lookupValue("graphics.framerate_limit", graphics_settings_.framerate_limit);
         configuration_.lookupValue("graphics.vertical_sync_enabled", graphics_settings_.vertical_sync_enabled);
+        configuration_.lookupValue("graphics.render_thread", graphics_settings_.render_thread);
 
         // TODO : Code saving values
         configuration_.lookupValue("font.size", font_settings_.size);
@@ -81,6 +82,8 @@ namespace tools {
         configuration_.lookupValue("enemy.max_vertices", enemy_settings_.max_vertices);
         configuration_.lookupValue("enemy.small_lifespan", enemy_settings_.small_lifespan);
         configuration_.lookupValue("enemy.spawn_interval", enemy_settings_.spawn_interval);
+        configuration_.lookupValue("enemy.shield_count", enemy_settings_.shield_count);
+        configuration_.lookupValue("enemy.shield_radius", enemy_settings_.shield_radius);
 
         // TODO : Code saving values
         configuration_.lookupValue("bullet.shape_radius", bullet_settings_.shape_radius);
@@ -96,6 +99,9 @@ namespace tools {
         configuration_.lookupValue("bullet.shape_vertices", bullet_settings_.shape_vertices);
         configuration_.lookupValue("bullet.lifespan", bullet_settings_.lifespan);
 
+        // TODO : Code saving values
+        configuration_.lookupValue("debug.rewind", debug_settings_.rewind);
+
         // TODO : Faire mieux... Je duplique dans tous les sens...
         assets_configuration_.setOptions(libconfig::Config::OptionFsync
                                          | libconfig::Config::OptionSemicolonSeparators
@@ -189,6 +195,11 @@ namespace tools {
         return asset_settings_;
     }
 
+    auto ConfigurationManager::getDebugSettings() -> DebugSettings &
+    {
+        return debug_settings_;
+    }
+
     auto ConfigurationManager::Save() const -> bool
     {
         try
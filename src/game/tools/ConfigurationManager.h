@@ -9,6 +9,7 @@
 
 #include "AssetsSettings.h"
 #include "BulletSettings.h"
+#include "DebugSettings.h"
 #include "EnemySettings.h"
 #include "FontSettings.h"
 #include "GraphicsSettings.h"
@@ -28,6 +29,7 @@ namespace tools {
         EnemySettings enemy_settings_;
         BulletSettings bullet_settings_;
         AssetsSettings asset_settings_;
+        DebugSettings debug_settings_;
 
         static auto getOrCreateGroup(libconfig::Setting &root, const std::string &key) -> libconfig::Setting &;
 
@@ -55,6 +57,8 @@ namespace tools {
 
         auto getAssetsSettings() -> AssetsSettings &;
 
+        auto getDebugSettings() -> DebugSettings &;
+
         [[nodiscard]] auto Save() const -> bool;
     };
 } // tools
@@ -0,0 +1,15 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef DEBUG_SETTINGS_H
+#define DEBUG_SETTINGS_H
+
+namespace tools {
+    struct DebugSettings {
+        // Historique des frames pour le retour arrière (Backspace) : un snapshot complet du monde par frame
+        bool rewind = false;
+    };
+} // tools
+
+#endif //DEBUG_SETTINGS_H
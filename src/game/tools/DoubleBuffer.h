@@ -0,0 +1,36 @@
+//
+// Created by Zéro Cool on 19/10/2026.
+//
+
+#ifndef DOUBLE_BUFFER_H
+#define DOUBLE_BUFFER_H
+
+#include <array>
+
+namespace tools {
+    /// @brief Double tampon : un tampon en écriture (simulation), un tampon en lecture (rendu)
+    ///
+    /// La bascule est un simple échange d'index : aucune copie. La synchronisation entre le
+    /// producteur et le consommateur est à la charge de l'appelant (le lecteur ne doit pas lire
+    /// pendant swap()).
+    ///
+    /// Les tampons sont réutilisés d'une frame à l'autre : remplir le tampon d'écriture en
+    /// réaffectant ses éléments évite toute allocation une fois la taille stabilisée.
+    template<typename T>
+    class DoubleBuffer {
+        std::array<T, 2> buffers_{};
+        unsigned front_ = 0;
+
+    public:
+        /// @brief Tampon en écriture (frame en cours de production)
+        auto back() -> T & { return buffers_[front_ ^ 1u]; }
+
+        /// @brief Tampon en lecture (dernière frame publiée)
+        auto front() const -> const T & { return buffers_[front_]; }
+
+        /// @brief Publie le tampon d'écriture
+        auto swap() -> void { front_ ^= 1u; }
+    };
+} // tools
+
+#endif //DOUBLE_BUFFER_H
@@ -19,6 +19,8 @@ namespace tools {
         int max_vertices = 7;
         int small_lifespan = 7;
         int spawn_interval = 7;
+        int shield_count = 2;
+        float shield_radius = 6.f;
     };
 }
 
@@ -15,6 +15,7 @@ namespace tools {
         int attribute_flags = 0;
         int framerate_limit = 60;
         bool vertical_sync_enabled = false;
+        bool render_thread = false;
     };
 } // tools
 